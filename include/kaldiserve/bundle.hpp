@@ -0,0 +1,89 @@
+// bundle.hpp - Model Bundle Interface
+#pragma once
+
+// stl includes
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+// kaldi includes
+#include "base/kaldi-types.h"
+
+// local includes
+#include "config.hpp"
+#include "types.hpp"
+
+
+namespace kaldiserve {
+
+// Version of the bundle layout written by `kaldiserve-pack`.
+const uint32 BUNDLE_VERSION = 1;
+
+// Single file model bundle, as written by `kaldiserve-pack`. Holds the
+// (already preprocessed) files of a model directory as named sections, e.g.
+// `final.mdl`, `HCLG.fst`, `conf/mfcc.conf` or `rnnlm/final.raw`.
+//
+// Layout: the "KSBUNDLE" magic, the version (uint32), the number of sections
+// (uint32) and then for each section its name (uint32 length + bytes), offset
+// and size (uint64 each). Sections start at page boundaries, so that aligned
+// const FSTs in them can be memory mapped right out of the bundle.
+class ModelBundle final {
+
+  public:
+    // tells if the file at path is a model bundle (and not a model directory)
+    static bool is_bundle(const std::string &path);
+
+    // directory that the relative paths of a model (e.g. its graphs) are
+    // resolved against: the model directory, or the directory of a bundle
+    static std::string root_dir(const std::string &path);
+
+    // reads the section table, the sections themselves are read on demand
+    explicit ModelBundle(const std::string &path);
+
+    // removes the files extracted by `extract`
+    ~ModelBundle();
+
+    ModelBundle(const ModelBundle &) = delete;
+    ModelBundle &operator=(const ModelBundle &) = delete;
+
+    inline const std::string &path() const noexcept { return path_; }
+
+    bool has(const std::string &name) const noexcept;
+
+    // byte offset of a section in the bundle file
+    uint64 offset(const std::string &name) const;
+
+    // Kaldi rxfilename (`<bundle>:<offset>`) of a section, to be read
+    // with `kaldi::Input` or `ReadKaldiObject` like any other model file
+    std::string rxfilename(const std::string &name) const;
+
+    // Text files (configs, word boundaries) are read until the end of the
+    // file and can not be read at an offset, so these are copied out into a
+    // temporary directory (removed with the bundle). Returns the file path.
+    std::string extract(const std::string &name);
+
+  private:
+    std::string path_;
+    std::string extract_dir_;
+    std::mutex extract_mutex_;
+    // name -> (offset, size)
+    std::map<std::string, std::pair<uint64, uint64>> sections_;
+};
+
+// Writes a model bundle out of files on disk.
+class ModelBundleWriter final {
+
+  public:
+    // adds the contents of a file as a section
+    void add(const std::string &name, const std::string &filepath);
+
+    void write(const std::string &path) const;
+
+  private:
+    // (name, filepath) in the order they were added
+    std::vector<std::pair<std::string, std::string>> sections_;
+};
+
+} // namespace kaldiserve
@@ -2,12 +2,17 @@
 #pragma once
 
 // stl includes
+#include <chrono>
 #include <condition_variable>
+#include <functional>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <stdexcept>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 // kaldi includes
@@ -39,6 +44,28 @@ namespace kaldiserve {
 
 // Forward declare class for friendship (hack for now)
 class ChainModel;
+class ModelRegistry;
+class WordTable;
+
+
+// Search settings of a model entry. Kept apart from the `ChainModel` so
+// that entries which differ only in these can share one loaded model.
+struct SearchProfile {
+    explicit SearchProfile(const ModelSpec &model_spec);
+
+    // entry spec (for the adaptive pruning floors and override limits)
+    ModelSpec model_spec;
+    // default search parameters
+    kaldi::LatticeFasterDecoderConfig decoder_config;
+};
+
+
+// Thrown by the decoding methods once the cancellation check of the
+// utterance (see `Decoder::set_cancel_check`) tells it is not needed anymore.
+class DecodingCancelled final : public std::runtime_error {
+  public:
+    DecodingCancelled() : std::runtime_error("decoding cancelled") {}
+};
 
 
 class Decoder final {
@@ -46,13 +73,24 @@ class Decoder final {
   public:
     explicit Decoder(ChainModel *const model);
 
+    Decoder(ChainModel *const model, const SearchProfile &profile);
+
     ~Decoder() noexcept;
 
     // SETUP METHODS
-    void start_decoding(const std::string &uuid="") noexcept;
+    // starts an utterance, decoded with the named graph of the model ("" for
+    // the default graph, which also is the only one rescored)
+    void start_decoding(const std::string &uuid="", const std::string &graph="");
 
     void free_decoder() noexcept;
 
+    // sets a check for the current utterance, polled between audio chunks
+    // and before lattice work; the decoding methods throw `DecodingCancelled`
+    // once it returns true. Cleared by `free_decoder`.
+    inline void set_cancel_check(const std::function<bool()> &is_cancelled) {
+        is_cancelled_ = is_cancelled;
+    }
+
     // STREAMING METHODS
 
     // decode an intermediate frame/chunk of a wav audio stream
@@ -85,9 +123,66 @@ class Decoder final {
                              const bool &word_level=false,
                              const bool &bidi_streaming=false);
 
+    // tells if results with the given options need lattice post-processing
+    // (otherwise `get_decoded_results` takes them from the best path directly)
+    bool needs_lattice(const int &n_best, const bool &word_level=false) const noexcept;
+
+    // get the compact lattice of the utterance, which can be post-processed
+    // with `find_alternatives` after the decoder has been released.
+    // returns false if no frames were decoded.
+    bool get_decoded_lattice(kaldi::CompactLattice &clat,
+                             const bool &bidi_streaming=false);
+
+    inline ChainModel *model() const noexcept {
+        return model_;
+    }
+
+    // spec of the model entry the decoder belongs to (shared models are
+    // loaded as per the first entry, see `ModelRegistry`)
+    inline const ModelSpec &model_spec() const noexcept {
+        return profile_.model_spec;
+    }
+
+    // SEARCH PARAMETERS
+
+    // sets the search parameters (beams etc.) used from the next utterance on
+    inline void set_search_config(const kaldi::LatticeFasterDecoderConfig &config) noexcept {
+        base_config_ = config;
+    }
+
+    // overrides search parameters for the next utterance only (0 keeps the
+    // base value), clamped to the limits in the model spec. Later utterances
+    // are back to the base parameters.
+    void override_search_config(const float &beam=0,
+                                const int &max_active=0,
+                                const float &lattice_beam=0) noexcept;
+
+    // search parameters of the current utterance
+    inline const kaldi::LatticeFasterDecoderConfig &search_config() const noexcept {
+        return decoder_config_;
+    }
+
+    // real time factor (decoding time / audio duration) of the current utterance
+    double real_time_factor() const noexcept;
+
+    // real time factor of the utterance decoded since the last call (0 if
+    // no audio was decoded since), so that each utterance is reported once
+    double take_real_time_factor() noexcept;
+
     DecoderOptions options{false, false};
 
   private:
+    // finishes decoding of the available audio, returns false if no frames
+    // were decoded
+    bool _finish_decoding(const bool &bidi_streaming);
+
+    // throws `DecodingCancelled` if the utterance was cancelled
+    void _check_cancelled() const;
+
+    // sets the search parameters of a new utterance (base config with the
+    // pending overrides applied) and clears the overrides
+    void _reset_search_config() noexcept;
+
     // decodes an intermediate wavepart
     void _decode_wave(kaldi::SubVector<kaldi::BaseFloat> &wave_part,
                       std::vector<std::pair<int32, kaldi::BaseFloat>> &delta_weights,
@@ -101,6 +196,11 @@ class Decoder final {
 
     // model vars
     ChainModel *model_;
+    // thread-safe copy of the model's decoding graph (lazily composed graphs
+    // keep a per-copy state cache that can not be shared across threads)
+    std::unique_ptr<fst::Fst<fst::StdArc>> decode_fst_;
+    // copies of the model's named graphs (made when first used)
+    std::map<std::string, std::unique_ptr<fst::Fst<fst::StdArc>>> graph_fsts_;
 
     // decoder vars (per utterance)
     kaldi::SingleUtteranceNnet3Decoder *decoder_;
@@ -108,8 +208,20 @@ class Decoder final {
     kaldi::OnlineSilenceWeighting *silence_weighting_;
     kaldi::OnlineIvectorExtractorAdaptationState *adaptation_state_;
 
+    // search parameters for new utterances (model defaults or as per load)
+    kaldi::LatticeFasterDecoderConfig base_config_;
+    // search parameters (per utterance)
+    kaldi::LatticeFasterDecoderConfig decoder_config_;
+    // overrides for the next utterance (0 keeps the base value)
+    float beam_override_, lattice_beam_override_;
+    int max_active_override_;
+    SearchProfile profile_;
+
     // req-specific vars
     std::string uuid_;
+    std::function<bool()> is_cancelled_;
+    // decoding time and audio duration (in secs) of the current utterance
+    double decode_secs_, audio_secs_;
 };
 
 
@@ -122,8 +234,11 @@ class DecoderFactory final {
 
     explicit DecoderFactory(const ModelSpec &model_spec);
 
+    // gets the model from the registry, sharing it with other factories
+    DecoderFactory(const ModelSpec &model_spec, ModelRegistry *const registry);
+
     inline Decoder *produce() const {
-        return new Decoder(model_.get());
+        return new Decoder(model_.get(), profile_);
     }
 
     // friendly alias for the producer method
@@ -132,7 +247,95 @@ class DecoderFactory final {
     }
 
   private:
-    std::unique_ptr<ChainModel> model_;
+    std::shared_ptr<ChainModel> model_;
+    SearchProfile profile_;
+};
+
+
+// Adapts the search parameters of new utterances to the load on a model.
+// Pruning is tightened step-wise (down to the configured floors) while the
+// average decoder wait time or real time factor is above its threshold and
+// relaxed again once both drop well below them.
+class PruningController final {
+
+  public:
+    PruningController(const ModelSpec &model_spec, const kaldi::LatticeFasterDecoderConfig &base_config);
+
+    // reports the time a request waited to acquire a decoder
+    void report_wait(const double &wait_ms);
+
+    // reports the real time factor of a finished utterance
+    void report_rtf(const double &rtf);
+
+    // search parameters for a new utterance at the current load level
+    kaldi::LatticeFasterDecoderConfig current_config();
+
+  private:
+    // updates the pruning level and config (expects mutex to be held)
+    void update_level_();
+
+    ModelSpec model_spec_;
+    kaldi::LatticeFasterDecoderConfig base_config_;
+    kaldi::LatticeFasterDecoderConfig config_;
+
+    std::mutex mutex_;
+    // moving averages of the load signals
+    double avg_wait_ms_, avg_rtf_;
+    // 0 (base search parameters) to 1 (floors)
+    double level_;
+};
+
+
+// A complete path through a lattice (word sequence and its costs)
+struct LatticePath {
+    std::vector<int32> word_ids;
+    // graph (lm) and acoustic costs
+    kaldi::LatticeWeight weight;
+    // (source state, arc index) of each lattice arc on the path, in order
+    std::vector<std::pair<int32, int32>> arcs;
+    int32 final_state;
+};
+
+
+// Lazily enumerates the paths of a (topologically sorted) compact lattice in
+// order of increasing cost. A best-first search guided by the exact best
+// cost-to-final of every state pops complete paths one at a time, so only as
+// much of the lattice is explored as the requested number of paths needs.
+// Paths with a word sequence that was already returned are skipped.
+class LatticePathEnumerator final {
+
+  public:
+    explicit LatticePathEnumerator(const kaldi::CompactLattice &clat);
+
+    // fills in the next best path, returns false when no paths are left
+    bool next(LatticePath &path);
+
+  private:
+    typedef kaldi::CompactLatticeArc::StateId StateId;
+
+    // partial path ending at `state` (or a complete one if `is_final`)
+    struct Node {
+        StateId state;
+        int32 parent;
+        int32 arc_idx;
+        double cost;
+        bool is_final;
+    };
+
+    // reconstructs the path ending at a final node
+    void _trace_path(const int32 &final_node_idx, LatticePath &path) const;
+
+    const kaldi::CompactLattice &clat_;
+    std::vector<double> backward_costs_;
+
+    std::vector<Node> nodes_;
+    // (cost estimate, node index) min-heap
+    std::priority_queue<std::pair<double, int32>,
+                        std::vector<std::pair<double, int32>>,
+                        std::greater<std::pair<double, int32>>> queue_;
+    std::size_t num_expansions_;
+
+    std::unordered_set<std::vector<int32>, kaldi::VectorHasher<int32>> seen_word_seqs_;
 };
 
 
@@ -141,7 +344,7 @@ class DecoderFactory final {
 class DecoderQueue final {
 
   public:
-    explicit DecoderQueue(const ModelSpec &);
+    explicit DecoderQueue(const ModelSpec &, ModelRegistry *const registry=nullptr);
 
     DecoderQueue(const DecoderQueue &) = delete; // disable copying
 
@@ -168,6 +371,11 @@ class DecoderQueue final {
     // pops a decoder object from the queue
     Decoder *pop_();
 
+    // Decodes sample audio with every (not yet queued up) decoder in
+    // parallel, so that nnet3 computations are compiled, the model memory is
+    // faulted in and the allocators have grown before the first request.
+    void warmup_(const ModelSpec &);
+
     // underlying STL "unsafe" queue for storing decoder objects
     std::queue<Decoder*> queue_;
     // custom mutex to make queue "thread-safe"
@@ -176,9 +384,28 @@ class DecoderQueue final {
     std::condition_variable cond_;
     // factory for producing new decoders on demand
     std::unique_ptr<DecoderFactory> decoder_factory_;
+    // load-adaptive search parameters (only when enabled for the model)
+    std::unique_ptr<PruningController> pruning_controller_;
 };
 
 
+// builds an alternative (transcript and scores) from a linear lattice
+void path_to_alternative(const kaldi::Lattice &path,
+                         const WordTable &word_table,
+                         Alternative &alt);
+
+// builds an alternative (transcript and scores) from a lattice path
+void path_to_alternative(const LatticePath &path,
+                         const WordTable &word_table,
+                         Alternative &alt);
+
+// Builds the linear compact lattice of a single enumerated path of `clat`
+// (keeps the transition ids needed for word alignment).
+void path_to_linear_lattice(const kaldi::CompactLattice &clat,
+                            const LatticePath &path,
+                            kaldi::CompactLattice *linear_clat);
+
+
 void find_alternatives(kaldi::CompactLattice &clat,
                        const std::size_t &n_best,
                        utterance_results_t &results,
@@ -0,0 +1,101 @@
+// graph.hpp - Decoding Graph Utilities Interface
+#pragma once
+
+// stl includes
+#include <memory>
+#include <string>
+#include <vector>
+
+// kaldi includes
+#include "fstext/fstext-lib.h"
+
+// local includes
+#include "config.hpp"
+
+
+namespace kaldiserve {
+
+// Per state access counts of a decoding graph (indexed by state id).
+using state_counts_t = std::vector<uint64>;
+
+// Fst wrapper that counts how often the arcs of each state are expanded
+// by a decoder. Used to record access patterns for graph reordering.
+// NOTE: Not thread-safe, only meant for offline (single decoder) use.
+class AccessCountingFst final : public fst::Fst<fst::StdArc> {
+
+  public:
+    typedef fst::StdArc Arc;
+    typedef Arc::StateId StateId;
+    typedef Arc::Weight Weight;
+
+    AccessCountingFst(const fst::Fst<Arc> &fst, state_counts_t *const state_counts);
+
+    StateId Start() const override { return fst_->Start(); }
+
+    Weight Final(StateId s) const override { return fst_->Final(s); }
+
+    size_t NumArcs(StateId s) const override { return fst_->NumArcs(s); }
+
+    size_t NumInputEpsilons(StateId s) const override { return fst_->NumInputEpsilons(s); }
+
+    size_t NumOutputEpsilons(StateId s) const override { return fst_->NumOutputEpsilons(s); }
+
+    uint64 Properties(uint64 mask, bool test) const override { return fst_->Properties(mask, test); }
+
+    const std::string &Type() const override { return fst_->Type(); }
+
+    fst::Fst<Arc> *Copy(bool safe = false) const override {
+        return new AccessCountingFst(*fst_, state_counts_);
+    }
+
+    const fst::SymbolTable *InputSymbols() const override { return fst_->InputSymbols(); }
+
+    const fst::SymbolTable *OutputSymbols() const override { return fst_->OutputSymbols(); }
+
+    void InitStateIterator(fst::StateIteratorData<Arc> *data) const override {
+        fst_->InitStateIterator(data);
+    }
+
+    void InitArcIterator(StateId s, fst::ArcIteratorData<Arc> *data) const override;
+
+  private:
+    std::unique_ptr<const fst::Fst<Arc>> fst_;
+    state_counts_t *state_counts_;
+};
+
+// Computes a cache friendly state order for a decoding graph. Frequently
+// accessed states (as per `state_counts`, if given) come first, sorted by
+// access count, followed by the remaining states in breadth first order from
+// the start state. `order[s]` is the new id of state `s`.
+void compute_graph_state_order(const fst::ExpandedFst<fst::StdArc> &graph,
+                               const state_counts_t *const state_counts,
+                               std::vector<fst::StdArc::StateId> &order);
+
+// Renumbers the states of a decoding graph as per `compute_graph_state_order`
+// and packs the arcs contiguously (in the new state order) in a const FST.
+fst::ConstFst<fst::StdArc> *reorder_graph(const fst::Fst<fst::StdArc> &graph,
+                                          const state_counts_t *const state_counts = nullptr);
+
+// Lazily composes an olabel lookahead `HCLr.fst` with its relabeled `Gr.fst`
+// (as produced by `utils/mkgraph_lookahead.sh`). The transition id
+// disambiguation symbols (`disambig_tid.int`) on the input side are mapped to
+// epsilons, as in Kaldi's `fst::LookaheadComposeFst`. `cache_mb` limits the
+// composed states cached by each copy of the graph.
+fst::Fst<fst::StdArc> *lookahead_compose(const fst::Fst<fst::StdArc> &hclr_fst,
+                                         const fst::Fst<fst::StdArc> &gr_fst,
+                                         const std::vector<int32> &disambig_tids,
+                                         const int &cache_mb);
+
+// Reads through all the states and arcs of an expanded graph, so that the
+// pages of a memory mapped graph are faulted in before they are needed during
+// search. Lazily expanded graphs (lookahead composition) are skipped.
+// Returns the number of arcs read.
+uint64 prefault_graph(const fst::Fst<fst::StdArc> &graph);
+
+// Reads state access counts from a text file with `<state-id> <count>` lines
+void read_state_counts(const std::string &filepath, state_counts_t &state_counts);
+
+// Writes state access counts (non zero counts only) to a text file
+void write_state_counts(const std::string &filepath, const state_counts_t &state_counts);
+
+} // namespace kaldiserve
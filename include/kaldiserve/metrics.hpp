@@ -0,0 +1,41 @@
+// metrics.hpp - Runtime Metrics Interface
+#pragma once
+
+// stl includes
+#include <map>
+#include <mutex>
+#include <string>
+
+// local includes
+#include "config.hpp"
+#include "types.hpp"
+
+
+namespace kaldiserve {
+
+// Process wide registry of named counters and gauges. Values are updated by
+// the library (decoder queues, models etc.) and exported by server plugins.
+class Metrics final {
+
+  public:
+    // adds `value` to a counter
+    void increment(const std::string &name, const double &value=1.0);
+
+    // sets the current value of a gauge
+    void set(const std::string &name, const double &value);
+
+    // copies the current values of all the metrics
+    std::map<std::string, double> snapshot();
+
+  private:
+    std::mutex mutex_;
+    std::map<std::string, double> values_;
+};
+
+// global metrics registry
+Metrics &metrics();
+
+// metric name labelled with the model, e.g. `decoder_wait_ms{model="general",language_code="en"}`
+std::string model_metric(const std::string &name, const ModelSpec &model_spec);
+
+} // namespace kaldiserve
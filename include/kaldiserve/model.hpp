@@ -2,12 +2,19 @@
 #pragma once
 
 // stl includes
+#include <list>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 // kaldi includes
 #include "base/kaldi-common.h"
 #include "util/common-utils.h"
 #include "rnnlm/rnnlm-lattice-rescoring.h"
+#include "lm/const-arpa-lm.h"
 #include "fstext/fstext-lib.h"
 #include "nnet3/nnet-utils.h"
 #include "online2/online-nnet2-feature-pipeline.h"
@@ -24,6 +31,113 @@
 
 namespace kaldiserve {
 
+// Compact word id -> string table. All words live in a single contiguous
+// string pool indexed by an offset array, so lookups don't allocate and the
+// footprint is much smaller than that of `fst::SymbolTable`'s hash maps.
+class WordTable final {
+
+  public:
+    // reads a text symbol table (`<word> <id>` per line, like words.txt)
+    void read_text(const std::string &filepath);
+
+    // (de)serializes the packed table in Kaldi binary format, which loads
+    // without re-parsing the text table (used for model bundles)
+    void read(std::istream &is, bool binary);
+    void write(std::ostream &os, bool binary) const;
+
+    // number of ids in the table (including gaps in the id space)
+    inline int32 size() const noexcept {
+        return offsets_.empty() ? 0 : offsets_.size() - 1;
+    }
+
+    // word for an id (empty for unknown ids)
+    std::string word(const int32 &id) const;
+
+    // joins the words for the given ids with a separator into output, which
+    // is sized upfront so that appending never reallocates
+    void join(const std::vector<int32> &word_ids, const char &separator, std::string &output) const;
+
+  private:
+    // word `i` is pool_[offsets_[i], offsets_[i + 1])
+    std::string pool_;
+    std::vector<uint32> offsets_;
+};
+
+// Thread safe, size bounded (LRU) cache of RNNLM states keyed by the
+// (truncated) word history that leads to them. Shared by all the decoders of
+// a model, so that common prefixes are not re-evaluated for every utterance.
+// Cached states are never modified, only read and extended from.
+class RnnlmStateCache final {
+
+  public:
+    typedef std::vector<int32> history_t;
+    typedef std::shared_ptr<const kaldi::rnnlm::RnnlmComputeState> state_t;
+
+    explicit RnnlmStateCache(const std::size_t &capacity);
+
+    // cached state for the history (nullptr on a miss)
+    state_t get(const history_t &history);
+
+    // adds a state to the cache, evicting the least recently used one if full
+    void put(const history_t &history, const state_t &state);
+
+    inline std::size_t capacity() const noexcept { return capacity_; }
+
+  private:
+    typedef std::list<std::pair<history_t, state_t>> entries_t;
+
+    std::size_t capacity_;
+
+    std::mutex mutex_;
+    // most recently used first
+    entries_t entries_;
+    std::unordered_map<history_t, entries_t::iterator, kaldi::VectorHasher<int32>> index_;
+};
+
+// Same as `kaldi::rnnlm::KaldiRnnlmDeterministicFst` (one instance per
+// lattice) but states for new histories are looked up in, and added to,
+// a shared `RnnlmStateCache` before being computed.
+class CachedRnnlmDeterministicFst final
+    : public fst::DeterministicOnDemandFst<fst::StdArc> {
+
+  public:
+    typedef fst::StdArc::Weight Weight;
+    typedef fst::StdArc::StateId StateId;
+    typedef fst::StdArc::Label Label;
+
+    CachedRnnlmDeterministicFst(const int32 &max_ngram_order,
+                                const kaldi::rnnlm::RnnlmComputeStateInfo &info,
+                                RnnlmStateCache *cache);
+
+    StateId Start() override { return start_state_; }
+
+    Weight Final(StateId s) override;
+
+    bool GetArc(StateId s, Label ilabel, fst::StdArc *oarc) override;
+
+    // cache lookups so far
+    inline std::size_t cache_hits() const noexcept { return cache_hits_; }
+    inline std::size_t cache_misses() const noexcept { return cache_misses_; }
+
+  private:
+    // cached state for a history or computes (and caches) it using `compute`
+    template <typename Compute>
+    RnnlmStateCache::state_t _lookup(const RnnlmStateCache::history_t &history, Compute compute);
+
+    const kaldi::rnnlm::RnnlmComputeStateInfo &info_;
+    RnnlmStateCache *cache_;
+
+    int32 max_ngram_order_;
+    StateId start_state_;
+    Label bos_index_, eos_index_;
+
+    std::unordered_map<RnnlmStateCache::history_t, StateId, kaldi::VectorHasher<Label>> wseq_to_state_;
+    std::vector<RnnlmStateCache::history_t> state_to_wseq_;
+    std::vector<RnnlmStateCache::state_t> state_to_rnnlm_state_;
+
+    std::size_t cache_hits_, cache_misses_;
+};
+
 // Chain (DNN-HMM NNet3) Model is a data class that holds all the
 // immutable ASR Model components that can be shared across Decoder instances.
 class ChainModel final {
@@ -34,16 +148,35 @@ class ChainModel final {
     // Model Config
     ModelSpec model_spec;
 
-    // HCLG.fst graph
+    // HCLG.fst graph (or the lazy HCLr o Gr composition in lookahead mode)
     std::unique_ptr<fst::Fst<fst::StdArc>> decode_fst;
 
+    // HCLr.fst (olabel lookahead) and Gr.fst (relabeled G) graphs, only
+    // loaded in lookahead mode
+    std::unique_ptr<fst::Fst<fst::StdArc>> hclr_fst;
+    std::unique_ptr<fst::Fst<fst::StdArc>> gr_fst;
+
     // NNet3 AM
     kaldi::nnet3::AmNnetSimple am_nnet;
     // Transition Model (HMM)
     kaldi::TransitionModel trans_model;
 
     // Word Symbols table (int->word)
-    std::unique_ptr<fst::SymbolTable> word_syms;
+    WordTable word_table;
+
+    // Additional named decoding graph, sharing all the acoustic components
+    struct Graph {
+        std::unique_ptr<fst::Fst<fst::StdArc>> decode_fst;
+        WordTable word_table;
+    };
+    std::map<std::string, Graph> graphs;
+
+    // tells if there is a decoding graph by the name ("" is the default graph)
+    bool has_graph(const std::string &name) const noexcept;
+
+    // decoding graph and its word table by name ("" is the default graph)
+    const fst::Fst<fst::StdArc> &graph_fst(const std::string &name) const;
+    const WordTable &graph_words(const std::string &name) const;
 
     // Online Feature Pipeline options
     std::unique_ptr<kaldi::OnlineNnet2FeaturePipelineInfo> feature_info;
@@ -56,6 +189,15 @@ class ChainModel final {
     // Word Boundary info (for word level timings)
     std::unique_ptr<kaldi::WordBoundaryInfo> wb_info;
 
+    // ConstArpa n-gram LM (G.carpa) for rescoring
+    std::unique_ptr<kaldi::ConstArpaLm> carpa_lm;
+    // First pass LM (G.fst) replaced by the ConstArpa LM
+    std::unique_ptr<const fst::VectorFst<fst::StdArc>> carpa_lm_to_subtract_fst;
+    // ConstArpa LM interpolation weight
+    kaldi::BaseFloat carpa_weight;
+    // ConstArpa LM composition options
+    kaldi::ComposeLatticePrunedOptions carpa_compose_opts;
+
     // NNet3 RNNLM
     kaldi::nnet3::Nnet rnnlm;
     // Word Embeddings matrix
@@ -64,6 +206,8 @@ class ChainModel final {
     std::unique_ptr<const fst::VectorFst<fst::StdArc>> lm_to_subtract_fst;  
     // RNNLM info object (encapsulates RNNLM, Word Embeddings and RNNLM options)
     std::unique_ptr<const kaldi::rnnlm::RnnlmComputeStateInfo> rnnlm_info;
+    // RNNLM states shared across utterances
+    std::unique_ptr<RnnlmStateCache> rnnlm_cache;
     
     // RNNLM interpolation weight
     kaldi::BaseFloat rnnlm_weight;
@@ -73,4 +217,28 @@ class ChainModel final {
     kaldi::ComposeLatticePrunedOptions compose_opts;
 };
 
-} // namespace kaldiserve
\ No newline at end of file
+// Shares `ChainModel`s between model specs that load the same model, i.e.
+// with the same (canonical) path and load options. Models are reference
+// counted and freed when their last user is gone.
+class ModelRegistry final {
+
+  public:
+    // loaded model for a spec, loading it if not already in use
+    std::shared_ptr<ChainModel> get(const ModelSpec &model_spec);
+
+    // specs with the same key share one model
+    static std::string load_key(const ModelSpec &model_spec);
+
+  private:
+
+    struct Slot {
+        // held while loading so that concurrent requests share one load
+        std::mutex mutex;
+        std::weak_ptr<ChainModel> model;
+    };
+
+    std::mutex mutex_;
+    std::map<std::string, std::shared_ptr<Slot>> slots_;
+};
+
+} // namespace kaldiserve
@@ -3,6 +3,7 @@
 
 // stl includes
 #include <iostream>
+#include <map>
 #include <string>
 #include <utility>
 #include <vector>
@@ -19,6 +20,21 @@ struct ModelSpec {
     std::string language_code;
     std::string path;
     int n_decoders = 1;
+    // load on first request (and allow eviction when over the memory budget)
+    bool lazy = false;
+    // additional named decoding graphs (name -> dir with HCLG.fst and words.txt)
+    std::map<std::string, std::string> graphs;
+
+    // warm-up (decodes sample audio with every decoder before serving)
+    bool warmup = true;
+    // wav file to warm up with (synthetic audio when empty)
+    std::string warmup_audio = "";
+    // read through the decoding graphs upfront (for memory mapped graphs)
+    bool prefault_graph = false;
+
+    // streaming limits, streams past them are cancelled (0 disables)
+    int stream_idle_timeout_ms = 0;
+    int max_stream_secs = 0;
 
     // decoding parameters
     int min_active = 200;
@@ -28,10 +44,38 @@ struct ModelSpec {
     float lattice_beam = 6.0;
     float acoustic_scale = 1.0;
     float silence_weight = 1.0;
+
+    // graph loading
+    bool mmap_graph = false;
+    bool lookahead_graph = false;
+    int lookahead_cache_mb = 64;
+    bool reorder_graph = false;
+
+    // adaptive pruning (tighter search under load)
+    bool adaptive_pruning = false;
+    float pressure_wait_ms = 100.0;
+    float pressure_rtf = 0.8;
+    int min_max_active = 1000;
+    float min_beam = 8.0;
+    float min_lattice_beam = 3.0;
+
+    // upper limits for per-request search parameters (0 uses the model's value)
+    int max_max_active = 0;
+    float max_beam = 0.0;
+    float max_lattice_beam = 0.0;
+
+    // word level output (mbr over the full lattice for confidences)
+    bool word_confidence = true;
     
+    // const arpa (G.carpa) rescoring config
+    float carpa_weight = 1.0;
+    float carpa_compose_beam = 6.0;
+    int carpa_max_arcs = 100000;
+
     // rnnlm config
     int max_ngram_order = 3;
     float rnnlm_weight = 0.5;
+    int rnnlm_cache_size = 10000;
     std::string bos_index = "1";
     std::string eos_index = "2";
 };
@@ -53,7 +97,10 @@ struct Alternative {
 // Options for decoder
 struct DecoderOptions {
     bool enable_word_level;
+    bool enable_carpa;
     bool enable_rnnlm;
+    // decoding graph of the current utterance ("" for the default one)
+    std::string graph;
 };
 
 // Result for one continuous utterance
@@ -19,6 +19,13 @@ std::string join_path(std::string a, std::string b);
 
 bool exists(std::string path);
 
+// Absolute path with symlinks, `.` and `..` resolved
+std::string canonical_path(std::string path);
+
+// Total size (in bytes) of all the files under a directory (or of a single
+// file, like a model bundle)
+std::size_t directory_size(std::string path);
+
 // Fills a list of model specifications from the config
 void parse_model_specs(const std::string &toml_path, std::vector<ModelSpec> &model_specs);
 
@@ -1,6 +1,6 @@
 import grpc
 
-from kaldi_serve.kaldi_serve_pb2 import RecognitionConfig, RecognizeRequest
+from kaldi_serve.kaldi_serve_pb2 import MetricsRequest, RecognitionConfig, RecognizeRequest
 from kaldi_serve.kaldi_serve_pb2_grpc import KaldiServeStub
 
 
@@ -33,4 +33,10 @@ class KaldiServeClient(object):
 
     def bidi_streaming_recognize_raw(self, audio_params_gen, uuid: str, timeout=None):
         request_gen = (RecognizeRequest(config=config, audio=chunk, uuid=uuid) for config, chunk in audio_params_gen)
-        return self._client.BidiStreamingRecognize(request_gen, timeout=timeout)
\ No newline at end of file
+        return self._client.BidiStreamingRecognize(request_gen, timeout=timeout)
+
+    def get_metrics(self, timeout=None):
+        """
+        Current values of the server's runtime metrics (name -> value).
+        """
+        return dict(self._client.GetMetrics(MetricsRequest(), timeout=timeout).metrics)
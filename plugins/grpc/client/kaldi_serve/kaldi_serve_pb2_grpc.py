@@ -29,6 +29,11 @@ class KaldiServeStub(object):
         request_serializer=kaldi__serve__pb2.RecognizeRequest.SerializeToString,
         response_deserializer=kaldi__serve__pb2.RecognizeResponse.FromString,
         )
+    self.GetMetrics = channel.unary_unary(
+        '/kaldi_serve.KaldiServe/GetMetrics',
+        request_serializer=kaldi__serve__pb2.MetricsRequest.SerializeToString,
+        response_deserializer=kaldi__serve__pb2.MetricsResponse.FromString,
+        )
 
 
 class KaldiServeServicer(object):
@@ -58,6 +63,13 @@ class KaldiServeServicer(object):
     context.set_details('Method not implemented!')
     raise NotImplementedError('Method not implemented!')
 
+  def GetMetrics(self, request, context):
+    """Returns the current values of the server's runtime metrics.
+    """
+    context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+    context.set_details('Method not implemented!')
+    raise NotImplementedError('Method not implemented!')
+
 
 def add_KaldiServeServicer_to_server(servicer, server):
   rpc_method_handlers = {
@@ -76,6 +88,11 @@ def add_KaldiServeServicer_to_server(servicer, server):
           request_deserializer=kaldi__serve__pb2.RecognizeRequest.FromString,
           response_serializer=kaldi__serve__pb2.RecognizeResponse.SerializeToString,
       ),
+      'GetMetrics': grpc.unary_unary_rpc_method_handler(
+          servicer.GetMetrics,
+          request_deserializer=kaldi__serve__pb2.MetricsRequest.FromString,
+          response_serializer=kaldi__serve__pb2.MetricsResponse.SerializeToString,
+      ),
   }
   generic_handler = grpc.method_handlers_generic_handler(
       'kaldi_serve.KaldiServe', rpc_method_handlers)
@@ -0,0 +1,45 @@
+"""
+Per-request search parameter overrides only apply to their own request and not
+to later requests that get the same (pooled) decoder. Needs the server running
+with the hindi model (and the audio file) from `test_hi.yaml`.
+"""
+
+import pytest
+
+from kaldi_serve import KaldiServeClient, RecognitionAudio, RecognitionConfig
+
+AUDIO_FILE = "./tests/resources/hi/one_two_three_four.wav"
+
+# requests are served sequentially, so this many requests in a row go through
+# every decoder of the model (at least its `n_decoders`)
+N_DECODERS = 20
+
+
+def recognize(client, audio, **overrides):
+    config = RecognitionConfig(
+        sample_rate_hertz=8000,
+        encoding=RecognitionConfig.AudioEncoding.LINEAR16,
+        language_code="hi",
+        max_alternatives=1,
+        model="general",
+        **overrides
+    )
+    return client.recognize(config, audio, uuid="").search_params
+
+
+def test_overrides_do_not_leak_to_later_requests():
+    client = KaldiServeClient()
+    with open(AUDIO_FILE, "rb") as fp:
+        audio = RecognitionAudio(content=fp.read())
+
+    defaults = recognize(client, audio)
+
+    overrides = {"max_active": defaults.max_active // 2, "lattice_beam": defaults.lattice_beam / 2}
+    for _ in range(N_DECODERS):
+        overridden = recognize(client, audio, **overrides)
+
+    if overridden.max_active == defaults.max_active and overridden.lattice_beam == defaults.lattice_beam:
+        pytest.skip("overrides are clamped away by the model's search limits")
+
+    for _ in range(N_DECODERS):
+        assert recognize(client, audio) == defaults
@@ -22,6 +22,7 @@ static const char* KaldiServe_method_names[] = {
   "/kaldi_serve.KaldiServe/Recognize",
   "/kaldi_serve.KaldiServe/StreamingRecognize",
   "/kaldi_serve.KaldiServe/BidiStreamingRecognize",
+  "/kaldi_serve.KaldiServe/GetMetrics",
 };
 
 std::unique_ptr< KaldiServe::Stub> KaldiServe::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -34,6 +35,7 @@ KaldiServe::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel
   : channel_(channel), rpcmethod_Recognize_(KaldiServe_method_names[0], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_StreamingRecognize_(KaldiServe_method_names[1], ::grpc::internal::RpcMethod::CLIENT_STREAMING, channel)
   , rpcmethod_BidiStreamingRecognize_(KaldiServe_method_names[2], ::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  , rpcmethod_GetMetrics_(KaldiServe_method_names[3], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status KaldiServe::Stub::Recognize(::grpc::ClientContext* context, const ::kaldi_serve::RecognizeRequest& request, ::kaldi_serve::RecognizeResponse* response) {
@@ -88,6 +90,26 @@ void KaldiServe::Stub::experimental_async::BidiStreamingRecognize(::grpc::Client
   return ::grpc::internal::ClientAsyncReaderWriterFactory< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>::Create(channel_.get(), cq, rpcmethod_BidiStreamingRecognize_, context, false, nullptr);
 }
 
+::grpc::Status KaldiServe::Stub::GetMetrics(::grpc::ClientContext* context, const ::kaldi_serve::MetricsRequest& request, ::kaldi_serve::MetricsResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_GetMetrics_, context, request, response);
+}
+
+void KaldiServe::Stub::experimental_async::GetMetrics(::grpc::ClientContext* context, const ::kaldi_serve::MetricsRequest* request, ::kaldi_serve::MetricsResponse* response, std::function<void(::grpc::Status)> f) {
+  return ::grpc::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_GetMetrics_, context, request, response, std::move(f));
+}
+
+void KaldiServe::Stub::experimental_async::GetMetrics(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::kaldi_serve::MetricsResponse* response, std::function<void(::grpc::Status)> f) {
+  return ::grpc::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_GetMetrics_, context, request, response, std::move(f));
+}
+
+::grpc::ClientAsyncResponseReader< ::kaldi_serve::MetricsResponse>* KaldiServe::Stub::AsyncGetMetricsRaw(::grpc::ClientContext* context, const ::kaldi_serve::MetricsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::kaldi_serve::MetricsResponse>::Create(channel_.get(), cq, rpcmethod_GetMetrics_, context, request, true);
+}
+
+::grpc::ClientAsyncResponseReader< ::kaldi_serve::MetricsResponse>* KaldiServe::Stub::PrepareAsyncGetMetricsRaw(::grpc::ClientContext* context, const ::kaldi_serve::MetricsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderFactory< ::kaldi_serve::MetricsResponse>::Create(channel_.get(), cq, rpcmethod_GetMetrics_, context, request, false);
+}
+
 KaldiServe::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       KaldiServe_method_names[0],
@@ -104,6 +126,11 @@ KaldiServe::Service::Service() {
       ::grpc::internal::RpcMethod::BIDI_STREAMING,
       new ::grpc::internal::BidiStreamingHandler< KaldiServe::Service, ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>(
           std::mem_fn(&KaldiServe::Service::BidiStreamingRecognize), this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KaldiServe_method_names[3],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KaldiServe::Service, ::kaldi_serve::MetricsRequest, ::kaldi_serve::MetricsResponse>(
+          std::mem_fn(&KaldiServe::Service::GetMetrics), this)));
 }
 
 KaldiServe::Service::~Service() {
@@ -129,6 +156,12 @@ KaldiServe::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status KaldiServe::Service::GetMetrics(::grpc::ServerContext* context, const ::kaldi_serve::MetricsRequest* request, ::kaldi_serve::MetricsResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
 
 }  // namespace kaldi_serve
 
@@ -67,6 +67,14 @@ class KaldiServe final {
     std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>> PrepareAsyncBidiStreamingRecognize(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>>(PrepareAsyncBidiStreamingRecognizeRaw(context, cq));
     }
+    // Returns the current values of the server's runtime metrics.
+    virtual ::grpc::Status GetMetrics(::grpc::ClientContext* context, const ::kaldi_serve::MetricsRequest& request, ::kaldi_serve::MetricsResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kaldi_serve::MetricsResponse>> AsyncGetMetrics(::grpc::ClientContext* context, const ::kaldi_serve::MetricsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kaldi_serve::MetricsResponse>>(AsyncGetMetricsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kaldi_serve::MetricsResponse>> PrepareAsyncGetMetrics(::grpc::ClientContext* context, const ::kaldi_serve::MetricsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kaldi_serve::MetricsResponse>>(PrepareAsyncGetMetricsRaw(context, request, cq));
+    }
     class experimental_async_interface {
      public:
       virtual ~experimental_async_interface() {}
@@ -79,6 +87,9 @@ class KaldiServe final {
       // Performs synchronous bidirectional streaming speech recognition: 
       //    receive results as the audio is being streamed and processed.
       virtual void BidiStreamingRecognize(::grpc::ClientContext* context, ::grpc::experimental::ClientBidiReactor< ::kaldi_serve::RecognizeRequest,::kaldi_serve::RecognizeResponse>* reactor) = 0;
+      // Returns the current values of the server's runtime metrics.
+      virtual void GetMetrics(::grpc::ClientContext* context, const ::kaldi_serve::MetricsRequest* request, ::kaldi_serve::MetricsResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetMetrics(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::kaldi_serve::MetricsResponse* response, std::function<void(::grpc::Status)>) = 0;
     };
     virtual class experimental_async_interface* experimental_async() { return nullptr; }
   private:
@@ -90,6 +101,8 @@ class KaldiServe final {
     virtual ::grpc::ClientReaderWriterInterface< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>* BidiStreamingRecognizeRaw(::grpc::ClientContext* context) = 0;
     virtual ::grpc::ClientAsyncReaderWriterInterface< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>* AsyncBidiStreamingRecognizeRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
     virtual ::grpc::ClientAsyncReaderWriterInterface< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>* PrepareAsyncBidiStreamingRecognizeRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::kaldi_serve::MetricsResponse>* AsyncGetMetricsRaw(::grpc::ClientContext* context, const ::kaldi_serve::MetricsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::kaldi_serve::MetricsResponse>* PrepareAsyncGetMetricsRaw(::grpc::ClientContext* context, const ::kaldi_serve::MetricsRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -119,6 +132,13 @@ class KaldiServe final {
     std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>> PrepareAsyncBidiStreamingRecognize(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>>(PrepareAsyncBidiStreamingRecognizeRaw(context, cq));
     }
+    ::grpc::Status GetMetrics(::grpc::ClientContext* context, const ::kaldi_serve::MetricsRequest& request, ::kaldi_serve::MetricsResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kaldi_serve::MetricsResponse>> AsyncGetMetrics(::grpc::ClientContext* context, const ::kaldi_serve::MetricsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kaldi_serve::MetricsResponse>>(AsyncGetMetricsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kaldi_serve::MetricsResponse>> PrepareAsyncGetMetrics(::grpc::ClientContext* context, const ::kaldi_serve::MetricsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kaldi_serve::MetricsResponse>>(PrepareAsyncGetMetricsRaw(context, request, cq));
+    }
     class experimental_async final :
       public StubInterface::experimental_async_interface {
      public:
@@ -126,6 +146,8 @@ class KaldiServe final {
       void Recognize(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::kaldi_serve::RecognizeResponse* response, std::function<void(::grpc::Status)>) override;
       void StreamingRecognize(::grpc::ClientContext* context, ::kaldi_serve::RecognizeResponse* response, ::grpc::experimental::ClientWriteReactor< ::kaldi_serve::RecognizeRequest>* reactor) override;
       void BidiStreamingRecognize(::grpc::ClientContext* context, ::grpc::experimental::ClientBidiReactor< ::kaldi_serve::RecognizeRequest,::kaldi_serve::RecognizeResponse>* reactor) override;
+      void GetMetrics(::grpc::ClientContext* context, const ::kaldi_serve::MetricsRequest* request, ::kaldi_serve::MetricsResponse* response, std::function<void(::grpc::Status)>) override;
+      void GetMetrics(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::kaldi_serve::MetricsResponse* response, std::function<void(::grpc::Status)>) override;
      private:
       friend class Stub;
       explicit experimental_async(Stub* stub): stub_(stub) { }
@@ -145,9 +167,12 @@ class KaldiServe final {
     ::grpc::ClientReaderWriter< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>* BidiStreamingRecognizeRaw(::grpc::ClientContext* context) override;
     ::grpc::ClientAsyncReaderWriter< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>* AsyncBidiStreamingRecognizeRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
     ::grpc::ClientAsyncReaderWriter< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>* PrepareAsyncBidiStreamingRecognizeRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::kaldi_serve::MetricsResponse>* AsyncGetMetricsRaw(::grpc::ClientContext* context, const ::kaldi_serve::MetricsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::kaldi_serve::MetricsResponse>* PrepareAsyncGetMetricsRaw(::grpc::ClientContext* context, const ::kaldi_serve::MetricsRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_Recognize_;
     const ::grpc::internal::RpcMethod rpcmethod_StreamingRecognize_;
     const ::grpc::internal::RpcMethod rpcmethod_BidiStreamingRecognize_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetMetrics_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -163,6 +188,8 @@ class KaldiServe final {
     // Performs synchronous bidirectional streaming speech recognition: 
     //    receive results as the audio is being streamed and processed.
     virtual ::grpc::Status BidiStreamingRecognize(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::kaldi_serve::RecognizeResponse, ::kaldi_serve::RecognizeRequest>* stream);
+    // Returns the current values of the server's runtime metrics.
+    virtual ::grpc::Status GetMetrics(::grpc::ServerContext* context, const ::kaldi_serve::MetricsRequest* request, ::kaldi_serve::MetricsResponse* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_Recognize : public BaseClass {
@@ -224,7 +251,27 @@ class KaldiServe final {
       ::grpc::Service::RequestAsyncBidiStreaming(2, context, stream, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_Recognize<WithAsyncMethod_StreamingRecognize<WithAsyncMethod_BidiStreamingRecognize<Service > > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service *service) {}
+   public:
+    WithAsyncMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodAsync(3);
+    }
+    ~WithAsyncMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* context, const ::kaldi_serve::MetricsRequest* request, ::kaldi_serve::MetricsResponse* response) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetMetrics(::grpc::ServerContext* context, ::kaldi_serve::MetricsRequest* request, ::grpc::ServerAsyncResponseWriter< ::kaldi_serve::MetricsResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_Recognize<WithAsyncMethod_StreamingRecognize<WithAsyncMethod_BidiStreamingRecognize<WithAsyncMethod_GetMetrics<Service > > > > AsyncService;
   template <class BaseClass>
   class ExperimentalWithCallbackMethod_Recognize : public BaseClass {
    private:
@@ -294,7 +341,32 @@ class KaldiServe final {
       return new ::grpc::internal::UnimplementedBidiReactor<
         ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>;}
   };
-  typedef ExperimentalWithCallbackMethod_Recognize<ExperimentalWithCallbackMethod_StreamingRecognize<ExperimentalWithCallbackMethod_BidiStreamingRecognize<Service > > > ExperimentalCallbackService;
+  template <class BaseClass>
+  class ExperimentalWithCallbackMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service *service) {}
+   public:
+    ExperimentalWithCallbackMethod_GetMetrics() {
+      ::grpc::Service::experimental().MarkMethodCallback(3,
+        new ::grpc::internal::CallbackUnaryHandler< ::kaldi_serve::MetricsRequest, ::kaldi_serve::MetricsResponse>(
+          [this](::grpc::ServerContext* context,
+                 const ::kaldi_serve::MetricsRequest* request,
+                 ::kaldi_serve::MetricsResponse* response,
+                 ::grpc::experimental::ServerCallbackRpcController* controller) {
+                   return this->GetMetrics(context, request, response, controller);
+                 }));
+    }
+    ~ExperimentalWithCallbackMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* context, const ::kaldi_serve::MetricsRequest* request, ::kaldi_serve::MetricsResponse* response) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual void GetMetrics(::grpc::ServerContext* context, const ::kaldi_serve::MetricsRequest* request, ::kaldi_serve::MetricsResponse* response, ::grpc::experimental::ServerCallbackRpcController* controller) { controller->Finish(::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "")); }
+  };
+  typedef ExperimentalWithCallbackMethod_Recognize<ExperimentalWithCallbackMethod_StreamingRecognize<ExperimentalWithCallbackMethod_BidiStreamingRecognize<ExperimentalWithCallbackMethod_GetMetrics<Service > > > > ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_Recognize : public BaseClass {
    private:
@@ -347,6 +419,23 @@ class KaldiServe final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service *service) {}
+   public:
+    WithGenericMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodGeneric(3);
+    }
+    ~WithGenericMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* context, const ::kaldi_serve::MetricsRequest* request, ::kaldi_serve::MetricsResponse* response) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_Recognize : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service *service) {}
@@ -407,6 +496,26 @@ class KaldiServe final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service *service) {}
+   public:
+    WithRawMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodRaw(3);
+    }
+    ~WithRawMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* context, const ::kaldi_serve::MetricsRequest* request, ::kaldi_serve::MetricsResponse* response) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetMetrics(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class ExperimentalWithRawCallbackMethod_Recognize : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service *service) {}
@@ -476,6 +585,31 @@ class KaldiServe final {
         ::grpc::ByteBuffer, ::grpc::ByteBuffer>;}
   };
   template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service *service) {}
+   public:
+    ExperimentalWithRawCallbackMethod_GetMetrics() {
+      ::grpc::Service::experimental().MarkMethodRawCallback(3,
+        new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+          [this](::grpc::ServerContext* context,
+                 const ::grpc::ByteBuffer* request,
+                 ::grpc::ByteBuffer* response,
+                 ::grpc::experimental::ServerCallbackRpcController* controller) {
+                   this->GetMetrics(context, request, response, controller);
+                 }));
+    }
+    ~ExperimentalWithRawCallbackMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* context, const ::kaldi_serve::MetricsRequest* request, ::kaldi_serve::MetricsResponse* response) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual void GetMetrics(::grpc::ServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response, ::grpc::experimental::ServerCallbackRpcController* controller) { controller->Finish(::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "")); }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_Recognize : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service *service) {}
@@ -495,9 +629,29 @@ class KaldiServe final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedRecognize(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::kaldi_serve::RecognizeRequest,::kaldi_serve::RecognizeResponse>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_Recognize<Service > StreamedUnaryService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service *service) {}
+   public:
+    WithStreamedUnaryMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodStreamed(3,
+        new ::grpc::internal::StreamedUnaryHandler< ::kaldi_serve::MetricsRequest, ::kaldi_serve::MetricsResponse>(std::bind(&WithStreamedUnaryMethod_GetMetrics<BaseClass>::StreamedGetMetrics, this, std::placeholders::_1, std::placeholders::_2)));
+    }
+    ~WithStreamedUnaryMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* context, const ::kaldi_serve::MetricsRequest* request, ::kaldi_serve::MetricsResponse* response) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetMetrics(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::kaldi_serve::MetricsRequest,::kaldi_serve::MetricsResponse>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_Recognize<WithStreamedUnaryMethod_GetMetrics<Service > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_Recognize<Service > StreamedService;
+  typedef WithStreamedUnaryMethod_Recognize<WithStreamedUnaryMethod_GetMetrics<Service > > StreamedService;
 };
 
 }  // namespace kaldi_serve
@@ -5,10 +5,9 @@
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/extension_set.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
@@ -16,335 +15,414 @@
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
 
-extern PROTOBUF_INTERNAL_EXPORT_kaldi_5fserve_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_RecognitionAudio_kaldi_5fserve_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_kaldi_5fserve_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_SpeechContext_kaldi_5fserve_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_kaldi_5fserve_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_Word_kaldi_5fserve_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_kaldi_5fserve_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_RecognitionConfig_kaldi_5fserve_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_kaldi_5fserve_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_SpeechRecognitionAlternative_kaldi_5fserve_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_kaldi_5fserve_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_SpeechRecognitionResult_kaldi_5fserve_2eproto;
-namespace kaldi_serve {
-class RecognizeRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<RecognizeRequest> _instance;
-} _RecognizeRequest_default_instance_;
-class RecognizeResponseDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<RecognizeResponse> _instance;
-} _RecognizeResponse_default_instance_;
-class RecognitionConfigDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<RecognitionConfig> _instance;
-} _RecognitionConfig_default_instance_;
-class RecognitionAudioDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<RecognitionAudio> _instance;
-  ::google::protobuf::internal::ArenaStringPtr content_;
-  ::google::protobuf::internal::ArenaStringPtr uri_;
-} _RecognitionAudio_default_instance_;
-class SpeechRecognitionResultDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<SpeechRecognitionResult> _instance;
-} _SpeechRecognitionResult_default_instance_;
-class SpeechRecognitionAlternativeDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<SpeechRecognitionAlternative> _instance;
-} _SpeechRecognitionAlternative_default_instance_;
-class WordDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Word> _instance;
-} _Word_default_instance_;
-class SpeechContextDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<SpeechContext> _instance;
-} _SpeechContext_default_instance_;
-}  // namespace kaldi_serve
-static void InitDefaultsRecognizeRequest_kaldi_5fserve_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::kaldi_serve::_RecognizeRequest_default_instance_;
-    new (ptr) ::kaldi_serve::RecognizeRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::kaldi_serve::RecognizeRequest::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<2> scc_info_RecognizeRequest_kaldi_5fserve_2eproto =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsRecognizeRequest_kaldi_5fserve_2eproto}, {
-      &scc_info_RecognitionConfig_kaldi_5fserve_2eproto.base,
-      &scc_info_RecognitionAudio_kaldi_5fserve_2eproto.base,}};
-
-static void InitDefaultsRecognizeResponse_kaldi_5fserve_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::kaldi_serve::_RecognizeResponse_default_instance_;
-    new (ptr) ::kaldi_serve::RecognizeResponse();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::kaldi_serve::RecognizeResponse::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_RecognizeResponse_kaldi_5fserve_2eproto =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsRecognizeResponse_kaldi_5fserve_2eproto}, {
-      &scc_info_SpeechRecognitionResult_kaldi_5fserve_2eproto.base,}};
-
-static void InitDefaultsRecognitionConfig_kaldi_5fserve_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::kaldi_serve::_RecognitionConfig_default_instance_;
-    new (ptr) ::kaldi_serve::RecognitionConfig();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::kaldi_serve::RecognitionConfig::InitAsDefaultInstance();
-}
+PROTOBUF_PRAGMA_INIT_SEG
 
-::google::protobuf::internal::SCCInfo<1> scc_info_RecognitionConfig_kaldi_5fserve_2eproto =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsRecognitionConfig_kaldi_5fserve_2eproto}, {
-      &scc_info_SpeechContext_kaldi_5fserve_2eproto.base,}};
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-static void InitDefaultsRecognitionAudio_kaldi_5fserve_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::kaldi_serve::_RecognitionAudio_default_instance_;
-    new (ptr) ::kaldi_serve::RecognitionAudio();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::kaldi_serve::RecognitionAudio::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_RecognitionAudio_kaldi_5fserve_2eproto =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsRecognitionAudio_kaldi_5fserve_2eproto}, {}};
-
-static void InitDefaultsSpeechRecognitionResult_kaldi_5fserve_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::kaldi_serve::_SpeechRecognitionResult_default_instance_;
-    new (ptr) ::kaldi_serve::SpeechRecognitionResult();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::kaldi_serve::SpeechRecognitionResult::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_SpeechRecognitionResult_kaldi_5fserve_2eproto =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsSpeechRecognitionResult_kaldi_5fserve_2eproto}, {
-      &scc_info_SpeechRecognitionAlternative_kaldi_5fserve_2eproto.base,}};
-
-static void InitDefaultsSpeechRecognitionAlternative_kaldi_5fserve_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::kaldi_serve::_SpeechRecognitionAlternative_default_instance_;
-    new (ptr) ::kaldi_serve::SpeechRecognitionAlternative();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::kaldi_serve::SpeechRecognitionAlternative::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_SpeechRecognitionAlternative_kaldi_5fserve_2eproto =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsSpeechRecognitionAlternative_kaldi_5fserve_2eproto}, {
-      &scc_info_Word_kaldi_5fserve_2eproto.base,}};
-
-static void InitDefaultsWord_kaldi_5fserve_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::kaldi_serve::_Word_default_instance_;
-    new (ptr) ::kaldi_serve::Word();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::kaldi_serve::Word::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_Word_kaldi_5fserve_2eproto =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsWord_kaldi_5fserve_2eproto}, {}};
-
-static void InitDefaultsSpeechContext_kaldi_5fserve_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::kaldi_serve::_SpeechContext_default_instance_;
-    new (ptr) ::kaldi_serve::SpeechContext();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::kaldi_serve::SpeechContext::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_SpeechContext_kaldi_5fserve_2eproto =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsSpeechContext_kaldi_5fserve_2eproto}, {}};
-
-void InitDefaults_kaldi_5fserve_2eproto() {
-  ::google::protobuf::internal::InitSCC(&scc_info_RecognizeRequest_kaldi_5fserve_2eproto.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_RecognizeResponse_kaldi_5fserve_2eproto.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_RecognitionConfig_kaldi_5fserve_2eproto.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_RecognitionAudio_kaldi_5fserve_2eproto.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_SpeechRecognitionResult_kaldi_5fserve_2eproto.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_SpeechRecognitionAlternative_kaldi_5fserve_2eproto.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_Word_kaldi_5fserve_2eproto.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_SpeechContext_kaldi_5fserve_2eproto.base);
-}
-
-::google::protobuf::Metadata file_level_metadata_kaldi_5fserve_2eproto[8];
-const ::google::protobuf::EnumDescriptor* file_level_enum_descriptors_kaldi_5fserve_2eproto[1];
-constexpr ::google::protobuf::ServiceDescriptor const** file_level_service_descriptors_kaldi_5fserve_2eproto = nullptr;
+namespace kaldi_serve {
+PROTOBUF_CONSTEXPR RecognizeRequest::RecognizeRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.uuid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.config_)*/nullptr
+  , /*decltype(_impl_.audio_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RecognizeRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RecognizeRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RecognizeRequestDefaultTypeInternal() {}
+  union {
+    RecognizeRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RecognizeRequestDefaultTypeInternal _RecognizeRequest_default_instance_;
+PROTOBUF_CONSTEXPR RecognizeResponse::RecognizeResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.results_)*/{}
+  , /*decltype(_impl_.search_params_)*/nullptr
+  , /*decltype(_impl_.first_pass_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RecognizeResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RecognizeResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RecognizeResponseDefaultTypeInternal() {}
+  union {
+    RecognizeResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RecognizeResponseDefaultTypeInternal _RecognizeResponse_default_instance_;
+PROTOBUF_CONSTEXPR SearchParams::SearchParams(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.beam_)*/0
+  , /*decltype(_impl_.max_active_)*/0
+  , /*decltype(_impl_.lattice_beam_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SearchParamsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SearchParamsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SearchParamsDefaultTypeInternal() {}
+  union {
+    SearchParams _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SearchParamsDefaultTypeInternal _SearchParams_default_instance_;
+PROTOBUF_CONSTEXPR MetricsRequest::MetricsRequest(
+    ::_pbi::ConstantInitialized) {}
+struct MetricsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetricsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetricsRequestDefaultTypeInternal() {}
+  union {
+    MetricsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetricsRequestDefaultTypeInternal _MetricsRequest_default_instance_;
+PROTOBUF_CONSTEXPR MetricsResponse_MetricsEntry_DoNotUse::MetricsResponse_MetricsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct MetricsResponse_MetricsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetricsResponse_MetricsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetricsResponse_MetricsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MetricsResponse_MetricsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetricsResponse_MetricsEntry_DoNotUseDefaultTypeInternal _MetricsResponse_MetricsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR MetricsResponse::MetricsResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.metrics_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MetricsResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetricsResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetricsResponseDefaultTypeInternal() {}
+  union {
+    MetricsResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetricsResponseDefaultTypeInternal _MetricsResponse_default_instance_;
+PROTOBUF_CONSTEXPR RecognitionConfig::RecognitionConfig(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.speech_contexts_)*/{}
+  , /*decltype(_impl_.language_code_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.model_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.graph_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.encoding_)*/0
+  , /*decltype(_impl_.sample_rate_hertz_)*/0
+  , /*decltype(_impl_.max_alternatives_)*/0
+  , /*decltype(_impl_.audio_channel_count_)*/0
+  , /*decltype(_impl_.punctuation_)*/false
+  , /*decltype(_impl_.raw_)*/false
+  , /*decltype(_impl_.word_level_)*/false
+  , /*decltype(_impl_.two_pass_)*/false
+  , /*decltype(_impl_.data_bytes_)*/0
+  , /*decltype(_impl_.beam_)*/0
+  , /*decltype(_impl_.max_active_)*/0
+  , /*decltype(_impl_.lattice_beam_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RecognitionConfigDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RecognitionConfigDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RecognitionConfigDefaultTypeInternal() {}
+  union {
+    RecognitionConfig _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RecognitionConfigDefaultTypeInternal _RecognitionConfig_default_instance_;
+PROTOBUF_CONSTEXPR RecognitionAudio::RecognitionAudio(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.audio_source_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct RecognitionAudioDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RecognitionAudioDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RecognitionAudioDefaultTypeInternal() {}
+  union {
+    RecognitionAudio _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RecognitionAudioDefaultTypeInternal _RecognitionAudio_default_instance_;
+PROTOBUF_CONSTEXPR SpeechRecognitionResult::SpeechRecognitionResult(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.alternatives_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SpeechRecognitionResultDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SpeechRecognitionResultDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SpeechRecognitionResultDefaultTypeInternal() {}
+  union {
+    SpeechRecognitionResult _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SpeechRecognitionResultDefaultTypeInternal _SpeechRecognitionResult_default_instance_;
+PROTOBUF_CONSTEXPR SpeechRecognitionAlternative::SpeechRecognitionAlternative(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.words_)*/{}
+  , /*decltype(_impl_.transcript_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.confidence_)*/0
+  , /*decltype(_impl_.am_score_)*/0
+  , /*decltype(_impl_.lm_score_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SpeechRecognitionAlternativeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SpeechRecognitionAlternativeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SpeechRecognitionAlternativeDefaultTypeInternal() {}
+  union {
+    SpeechRecognitionAlternative _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SpeechRecognitionAlternativeDefaultTypeInternal _SpeechRecognitionAlternative_default_instance_;
+PROTOBUF_CONSTEXPR Word::Word(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.word_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.start_time_)*/0
+  , /*decltype(_impl_.end_time_)*/0
+  , /*decltype(_impl_.confidence_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WordDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WordDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WordDefaultTypeInternal() {}
+  union {
+    Word _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WordDefaultTypeInternal _Word_default_instance_;
+PROTOBUF_CONSTEXPR SpeechContext::SpeechContext(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.phrases_)*/{}
+  , /*decltype(_impl_.type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SpeechContextDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SpeechContextDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SpeechContextDefaultTypeInternal() {}
+  union {
+    SpeechContext _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SpeechContextDefaultTypeInternal _SpeechContext_default_instance_;
+}  // namespace kaldi_serve
+static ::_pb::Metadata file_level_metadata_kaldi_5fserve_2eproto[12];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_kaldi_5fserve_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_kaldi_5fserve_2eproto = nullptr;
 
-const ::google::protobuf::uint32 TableStruct_kaldi_5fserve_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_kaldi_5fserve_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeRequest, config_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeRequest, audio_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeRequest, uuid_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeRequest, _impl_.config_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeRequest, _impl_.audio_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeRequest, _impl_.uuid_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeResponse, results_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeResponse, _impl_.results_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeResponse, _impl_.search_params_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeResponse, _impl_.first_pass_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SearchParams, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SearchParams, _impl_.beam_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SearchParams, _impl_.max_active_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SearchParams, _impl_.lattice_beam_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::MetricsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::MetricsResponse_MetricsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::MetricsResponse_MetricsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::MetricsResponse_MetricsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::MetricsResponse_MetricsEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::MetricsResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::MetricsResponse, _impl_.metrics_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, encoding_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, sample_rate_hertz_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, language_code_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, max_alternatives_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, punctuation_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, speech_contexts_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, audio_channel_count_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, model_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, raw_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, data_bytes_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, word_level_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.encoding_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.sample_rate_hertz_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.language_code_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.max_alternatives_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.punctuation_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.speech_contexts_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.audio_channel_count_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.model_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.raw_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.data_bytes_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.word_level_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.beam_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.max_active_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.lattice_beam_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.two_pass_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.graph_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionAudio, _internal_metadata_),
   ~0u,  // no _extensions_
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionAudio, _oneof_case_[0]),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionAudio, _impl_._oneof_case_[0]),
   ~0u,  // no _weak_field_map_
-  offsetof(::kaldi_serve::RecognitionAudioDefaultTypeInternal, content_),
-  offsetof(::kaldi_serve::RecognitionAudioDefaultTypeInternal, uri_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionAudio, audio_source_),
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionAudio, _impl_.audio_source_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionResult, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionResult, alternatives_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionResult, _impl_.alternatives_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionAlternative, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionAlternative, transcript_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionAlternative, confidence_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionAlternative, am_score_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionAlternative, lm_score_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionAlternative, words_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionAlternative, _impl_.transcript_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionAlternative, _impl_.confidence_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionAlternative, _impl_.am_score_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionAlternative, _impl_.lm_score_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionAlternative, _impl_.words_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::kaldi_serve::Word, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::Word, start_time_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::Word, end_time_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::Word, word_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::Word, confidence_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::Word, _impl_.start_time_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::Word, _impl_.end_time_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::Word, _impl_.word_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::Word, _impl_.confidence_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechContext, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechContext, phrases_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechContext, type_),
-};
-static const ::google::protobuf::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::kaldi_serve::RecognizeRequest)},
-  { 8, -1, sizeof(::kaldi_serve::RecognizeResponse)},
-  { 14, -1, sizeof(::kaldi_serve::RecognitionConfig)},
-  { 30, -1, sizeof(::kaldi_serve::RecognitionAudio)},
-  { 38, -1, sizeof(::kaldi_serve::SpeechRecognitionResult)},
-  { 44, -1, sizeof(::kaldi_serve::SpeechRecognitionAlternative)},
-  { 54, -1, sizeof(::kaldi_serve::Word)},
-  { 63, -1, sizeof(::kaldi_serve::SpeechContext)},
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechContext, _impl_.phrases_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechContext, _impl_.type_),
 };
-
-static ::google::protobuf::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::google::protobuf::Message*>(&::kaldi_serve::_RecognizeRequest_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::kaldi_serve::_RecognizeResponse_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::kaldi_serve::_RecognitionConfig_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::kaldi_serve::_RecognitionAudio_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::kaldi_serve::_SpeechRecognitionResult_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::kaldi_serve::_SpeechRecognitionAlternative_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::kaldi_serve::_Word_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::kaldi_serve::_SpeechContext_default_instance_),
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::kaldi_serve::RecognizeRequest)},
+  { 9, -1, -1, sizeof(::kaldi_serve::RecognizeResponse)},
+  { 18, -1, -1, sizeof(::kaldi_serve::SearchParams)},
+  { 27, -1, -1, sizeof(::kaldi_serve::MetricsRequest)},
+  { 33, 41, -1, sizeof(::kaldi_serve::MetricsResponse_MetricsEntry_DoNotUse)},
+  { 43, -1, -1, sizeof(::kaldi_serve::MetricsResponse)},
+  { 50, -1, -1, sizeof(::kaldi_serve::RecognitionConfig)},
+  { 72, -1, -1, sizeof(::kaldi_serve::RecognitionAudio)},
+  { 81, -1, -1, sizeof(::kaldi_serve::SpeechRecognitionResult)},
+  { 88, -1, -1, sizeof(::kaldi_serve::SpeechRecognitionAlternative)},
+  { 99, -1, -1, sizeof(::kaldi_serve::Word)},
+  { 109, -1, -1, sizeof(::kaldi_serve::SpeechContext)},
 };
 
-::google::protobuf::internal::AssignDescriptorsTable assign_descriptors_table_kaldi_5fserve_2eproto = {
-  {}, AddDescriptors_kaldi_5fserve_2eproto, "kaldi_serve.proto", schemas,
-  file_default_instances, TableStruct_kaldi_5fserve_2eproto::offsets,
-  file_level_metadata_kaldi_5fserve_2eproto, 8, file_level_enum_descriptors_kaldi_5fserve_2eproto, file_level_service_descriptors_kaldi_5fserve_2eproto,
+static const ::_pb::Message* const file_default_instances[] = {
+  &::kaldi_serve::_RecognizeRequest_default_instance_._instance,
+  &::kaldi_serve::_RecognizeResponse_default_instance_._instance,
+  &::kaldi_serve::_SearchParams_default_instance_._instance,
+  &::kaldi_serve::_MetricsRequest_default_instance_._instance,
+  &::kaldi_serve::_MetricsResponse_MetricsEntry_DoNotUse_default_instance_._instance,
+  &::kaldi_serve::_MetricsResponse_default_instance_._instance,
+  &::kaldi_serve::_RecognitionConfig_default_instance_._instance,
+  &::kaldi_serve::_RecognitionAudio_default_instance_._instance,
+  &::kaldi_serve::_SpeechRecognitionResult_default_instance_._instance,
+  &::kaldi_serve::_SpeechRecognitionAlternative_default_instance_._instance,
+  &::kaldi_serve::_Word_default_instance_._instance,
+  &::kaldi_serve::_SpeechContext_default_instance_._instance,
 };
 
-const char descriptor_table_protodef_kaldi_5fserve_2eproto[] =
+const char descriptor_table_protodef_kaldi_5fserve_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\021kaldi_serve.proto\022\013kaldi_serve\"~\n\020Reco"
   "gnizeRequest\022.\n\006config\030\001 \001(\0132\036.kaldi_ser"
   "ve.RecognitionConfig\022,\n\005audio\030\002 \001(\0132\035.ka"
   "ldi_serve.RecognitionAudio\022\014\n\004uuid\030\003 \001(\t"
-  "\"J\n\021RecognizeResponse\0225\n\007results\030\001 \003(\0132$"
-  ".kaldi_serve.SpeechRecognitionResult\"\215\003\n"
-  "\021RecognitionConfig\022>\n\010encoding\030\001 \001(\0162,.k"
-  "aldi_serve.RecognitionConfig.AudioEncodi"
-  "ng\022\031\n\021sample_rate_hertz\030\002 \001(\005\022\025\n\rlanguag"
-  "e_code\030\003 \001(\t\022\030\n\020max_alternatives\030\004 \001(\005\022\023"
-  "\n\013punctuation\030\005 \001(\010\0223\n\017speech_contexts\030\006"
-  " \003(\0132\032.kaldi_serve.SpeechContext\022\033\n\023audi"
-  "o_channel_count\030\007 \001(\005\022\r\n\005model\030\n \001(\t\022\013\n\003"
-  "raw\030\013 \001(\010\022\022\n\ndata_bytes\030\014 \001(\005\022\022\n\nword_le"
-  "vel\030\r \001(\010\"A\n\rAudioEncoding\022\030\n\024ENCODING_U"
-  "NSPECIFIED\020\000\022\014\n\010LINEAR16\020\001\022\010\n\004FLAC\020\002\"D\n\020"
-  "RecognitionAudio\022\021\n\007content\030\001 \001(\014H\000\022\r\n\003u"
-  "ri\030\002 \001(\tH\000B\016\n\014audio_source\"Z\n\027SpeechReco"
-  "gnitionResult\022\?\n\014alternatives\030\001 \003(\0132).ka"
-  "ldi_serve.SpeechRecognitionAlternative\"\214"
-  "\001\n\034SpeechRecognitionAlternative\022\022\n\ntrans"
-  "cript\030\001 \001(\t\022\022\n\nconfidence\030\002 \001(\002\022\020\n\010am_sc"
-  "ore\030\003 \001(\002\022\020\n\010lm_score\030\004 \001(\002\022 \n\005words\030\005 \003"
-  "(\0132\021.kaldi_serve.Word\"N\n\004Word\022\022\n\nstart_t"
-  "ime\030\001 \001(\002\022\020\n\010end_time\030\002 \001(\002\022\014\n\004word\030\003 \001("
-  "\t\022\022\n\nconfidence\030\004 \001(\002\".\n\rSpeechContext\022\017"
-  "\n\007phrases\030\001 \003(\t\022\014\n\004type\030\002 \001(\t2\222\002\n\nKaldiS"
-  "erve\022L\n\tRecognize\022\035.kaldi_serve.Recogniz"
-  "eRequest\032\036.kaldi_serve.RecognizeResponse"
-  "\"\000\022W\n\022StreamingRecognize\022\035.kaldi_serve.R"
-  "ecognizeRequest\032\036.kaldi_serve.RecognizeR"
-  "esponse\"\000(\001\022]\n\026BidiStreamingRecognize\022\035."
-  "kaldi_serve.RecognizeRequest\032\036.kaldi_ser"
-  "ve.RecognizeResponse\"\000(\0010\001b\006proto3"
+  "\"\220\001\n\021RecognizeResponse\0225\n\007results\030\001 \003(\0132"
+  "$.kaldi_serve.SpeechRecognitionResult\0220\n"
+  "\rsearch_params\030\002 \001(\0132\031.kaldi_serve.Searc"
+  "hParams\022\022\n\nfirst_pass\030\003 \001(\010\"F\n\014SearchPar"
+  "ams\022\014\n\004beam\030\001 \001(\002\022\022\n\nmax_active\030\002 \001(\005\022\024\n"
+  "\014lattice_beam\030\003 \001(\002\"\020\n\016MetricsRequest\"}\n"
+  "\017MetricsResponse\022:\n\007metrics\030\001 \003(\0132).kald"
+  "i_serve.MetricsResponse.MetricsEntry\032.\n\014"
+  "MetricsEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\001"
+  ":\0028\001\"\346\003\n\021RecognitionConfig\022>\n\010encoding\030\001"
+  " \001(\0162,.kaldi_serve.RecognitionConfig.Aud"
+  "ioEncoding\022\031\n\021sample_rate_hertz\030\002 \001(\005\022\025\n"
+  "\rlanguage_code\030\003 \001(\t\022\030\n\020max_alternatives"
+  "\030\004 \001(\005\022\023\n\013punctuation\030\005 \001(\010\0223\n\017speech_co"
+  "ntexts\030\006 \003(\0132\032.kaldi_serve.SpeechContext"
+  "\022\033\n\023audio_channel_count\030\007 \001(\005\022\r\n\005model\030\n"
+  " \001(\t\022\013\n\003raw\030\013 \001(\010\022\022\n\ndata_bytes\030\014 \001(\005\022\022\n"
+  "\nword_level\030\r \001(\010\022\014\n\004beam\030\016 \001(\002\022\022\n\nmax_a"
+  "ctive\030\017 \001(\005\022\024\n\014lattice_beam\030\020 \001(\002\022\020\n\010two"
+  "_pass\030\021 \001(\010\022\r\n\005graph\030\022 \001(\t\"A\n\rAudioEncod"
+  "ing\022\030\n\024ENCODING_UNSPECIFIED\020\000\022\014\n\010LINEAR1"
+  "6\020\001\022\010\n\004FLAC\020\002\"D\n\020RecognitionAudio\022\021\n\007con"
+  "tent\030\001 \001(\014H\000\022\r\n\003uri\030\002 \001(\tH\000B\016\n\014audio_sou"
+  "rce\"Z\n\027SpeechRecognitionResult\022\?\n\014altern"
+  "atives\030\001 \003(\0132).kaldi_serve.SpeechRecogni"
+  "tionAlternative\"\214\001\n\034SpeechRecognitionAlt"
+  "ernative\022\022\n\ntranscript\030\001 \001(\t\022\022\n\nconfiden"
+  "ce\030\002 \001(\002\022\020\n\010am_score\030\003 \001(\002\022\020\n\010lm_score\030\004"
+  " \001(\002\022 \n\005words\030\005 \003(\0132\021.kaldi_serve.Word\"N"
+  "\n\004Word\022\022\n\nstart_time\030\001 \001(\002\022\020\n\010end_time\030\002"
+  " \001(\002\022\014\n\004word\030\003 \001(\t\022\022\n\nconfidence\030\004 \001(\002\"."
+  "\n\rSpeechContext\022\017\n\007phrases\030\001 \003(\t\022\014\n\004type"
+  "\030\002 \001(\t2\335\002\n\nKaldiServe\022L\n\tRecognize\022\035.kal"
+  "di_serve.RecognizeRequest\032\036.kaldi_serve."
+  "RecognizeResponse\"\000\022W\n\022StreamingRecogniz"
+  "e\022\035.kaldi_serve.RecognizeRequest\032\036.kaldi"
+  "_serve.RecognizeResponse\"\000(\001\022]\n\026BidiStre"
+  "amingRecognize\022\035.kaldi_serve.RecognizeRe"
+  "quest\032\036.kaldi_serve.RecognizeResponse\"\000("
+  "\0010\001\022I\n\nGetMetrics\022\033.kaldi_serve.MetricsR"
+  "equest\032\034.kaldi_serve.MetricsResponse\"\000b\006"
+  "proto3"
   ;
-::google::protobuf::internal::DescriptorTable descriptor_table_kaldi_5fserve_2eproto = {
-  false, InitDefaults_kaldi_5fserve_2eproto, 
-  descriptor_table_protodef_kaldi_5fserve_2eproto,
-  "kaldi_serve.proto", &assign_descriptors_table_kaldi_5fserve_2eproto, 1354,
+static ::_pbi::once_flag descriptor_table_kaldi_5fserve_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_kaldi_5fserve_2eproto = {
+    false, false, 1806, descriptor_table_protodef_kaldi_5fserve_2eproto,
+    "kaldi_serve.proto",
+    &descriptor_table_kaldi_5fserve_2eproto_once, nullptr, 0, 12,
+    schemas, file_default_instances, TableStruct_kaldi_5fserve_2eproto::offsets,
+    file_level_metadata_kaldi_5fserve_2eproto, file_level_enum_descriptors_kaldi_5fserve_2eproto,
+    file_level_service_descriptors_kaldi_5fserve_2eproto,
 };
-
-void AddDescriptors_kaldi_5fserve_2eproto() {
-  static constexpr ::google::protobuf::internal::InitFunc deps[1] =
-  {
-  };
- ::google::protobuf::internal::AddDescriptors(&descriptor_table_kaldi_5fserve_2eproto, deps, 0);
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_kaldi_5fserve_2eproto_getter() {
+  return &descriptor_table_kaldi_5fserve_2eproto;
 }
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_kaldi_5fserve_2eproto = []() { AddDescriptors_kaldi_5fserve_2eproto(); return true; }();
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_kaldi_5fserve_2eproto(&descriptor_table_kaldi_5fserve_2eproto);
 namespace kaldi_serve {
-const ::google::protobuf::EnumDescriptor* RecognitionConfig_AudioEncoding_descriptor() {
-  ::google::protobuf::internal::AssignDescriptors(&assign_descriptors_table_kaldi_5fserve_2eproto);
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RecognitionConfig_AudioEncoding_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_kaldi_5fserve_2eproto);
   return file_level_enum_descriptors_kaldi_5fserve_2eproto[0];
 }
 bool RecognitionConfig_AudioEncoding_IsValid(int value) {
@@ -358,1299 +436,1528 @@ bool RecognitionConfig_AudioEncoding_IsValid(int value) {
   }
 }
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const RecognitionConfig_AudioEncoding RecognitionConfig::ENCODING_UNSPECIFIED;
-const RecognitionConfig_AudioEncoding RecognitionConfig::LINEAR16;
-const RecognitionConfig_AudioEncoding RecognitionConfig::FLAC;
-const RecognitionConfig_AudioEncoding RecognitionConfig::AudioEncoding_MIN;
-const RecognitionConfig_AudioEncoding RecognitionConfig::AudioEncoding_MAX;
-const int RecognitionConfig::AudioEncoding_ARRAYSIZE;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr RecognitionConfig_AudioEncoding RecognitionConfig::ENCODING_UNSPECIFIED;
+constexpr RecognitionConfig_AudioEncoding RecognitionConfig::LINEAR16;
+constexpr RecognitionConfig_AudioEncoding RecognitionConfig::FLAC;
+constexpr RecognitionConfig_AudioEncoding RecognitionConfig::AudioEncoding_MIN;
+constexpr RecognitionConfig_AudioEncoding RecognitionConfig::AudioEncoding_MAX;
+constexpr int RecognitionConfig::AudioEncoding_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
 // ===================================================================
 
-void RecognizeRequest::InitAsDefaultInstance() {
-  ::kaldi_serve::_RecognizeRequest_default_instance_._instance.get_mutable()->config_ = const_cast< ::kaldi_serve::RecognitionConfig*>(
-      ::kaldi_serve::RecognitionConfig::internal_default_instance());
-  ::kaldi_serve::_RecognizeRequest_default_instance_._instance.get_mutable()->audio_ = const_cast< ::kaldi_serve::RecognitionAudio*>(
-      ::kaldi_serve::RecognitionAudio::internal_default_instance());
-}
-class RecognizeRequest::HasBitSetters {
+class RecognizeRequest::_Internal {
  public:
   static const ::kaldi_serve::RecognitionConfig& config(const RecognizeRequest* msg);
   static const ::kaldi_serve::RecognitionAudio& audio(const RecognizeRequest* msg);
 };
 
 const ::kaldi_serve::RecognitionConfig&
-RecognizeRequest::HasBitSetters::config(const RecognizeRequest* msg) {
-  return *msg->config_;
+RecognizeRequest::_Internal::config(const RecognizeRequest* msg) {
+  return *msg->_impl_.config_;
 }
 const ::kaldi_serve::RecognitionAudio&
-RecognizeRequest::HasBitSetters::audio(const RecognizeRequest* msg) {
-  return *msg->audio_;
+RecognizeRequest::_Internal::audio(const RecognizeRequest* msg) {
+  return *msg->_impl_.audio_;
 }
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int RecognizeRequest::kConfigFieldNumber;
-const int RecognizeRequest::kAudioFieldNumber;
-const int RecognizeRequest::kUuidFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-RecognizeRequest::RecognizeRequest()
-  : ::google::protobuf::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:kaldi_serve.RecognizeRequest)
+RecognizeRequest::RecognizeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.RecognizeRequest)
 }
 RecognizeRequest::RecognizeRequest(const RecognizeRequest& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  uuid_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.uuid().size() > 0) {
-    uuid_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.uuid_);
-  }
-  if (from.has_config()) {
-    config_ = new ::kaldi_serve::RecognitionConfig(*from.config_);
-  } else {
-    config_ = nullptr;
-  }
-  if (from.has_audio()) {
-    audio_ = new ::kaldi_serve::RecognitionAudio(*from.audio_);
-  } else {
-    audio_ = nullptr;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RecognizeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uuid_){}
+    , decltype(_impl_.config_){nullptr}
+    , decltype(_impl_.audio_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_uuid().empty()) {
+    _this->_impl_.uuid_.Set(from._internal_uuid(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_config()) {
+    _this->_impl_.config_ = new ::kaldi_serve::RecognitionConfig(*from._impl_.config_);
+  }
+  if (from._internal_has_audio()) {
+    _this->_impl_.audio_ = new ::kaldi_serve::RecognitionAudio(*from._impl_.audio_);
   }
   // @@protoc_insertion_point(copy_constructor:kaldi_serve.RecognizeRequest)
 }
 
-void RecognizeRequest::SharedCtor() {
-  ::google::protobuf::internal::InitSCC(
-      &scc_info_RecognizeRequest_kaldi_5fserve_2eproto.base);
-  uuid_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&config_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&audio_) -
-      reinterpret_cast<char*>(&config_)) + sizeof(audio_));
+inline void RecognizeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uuid_){}
+    , decltype(_impl_.config_){nullptr}
+    , decltype(_impl_.audio_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 RecognizeRequest::~RecognizeRequest() {
   // @@protoc_insertion_point(destructor:kaldi_serve.RecognizeRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void RecognizeRequest::SharedDtor() {
-  uuid_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete config_;
-  if (this != internal_default_instance()) delete audio_;
+inline void RecognizeRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.uuid_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.config_;
+  if (this != internal_default_instance()) delete _impl_.audio_;
 }
 
 void RecognizeRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const RecognizeRequest& RecognizeRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&::scc_info_RecognizeRequest_kaldi_5fserve_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void RecognizeRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:kaldi_serve.RecognizeRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == nullptr && config_ != nullptr) {
-    delete config_;
-  }
-  config_ = nullptr;
-  if (GetArenaNoVirtual() == nullptr && audio_ != nullptr) {
-    delete audio_;
-  }
-  audio_ = nullptr;
-  _internal_metadata_.Clear();
-}
-
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* RecognizeRequest::_InternalParse(const char* begin, const char* end, void* object,
-                  ::google::protobuf::internal::ParseContext* ctx) {
-  auto msg = static_cast<RecognizeRequest*>(object);
-  ::google::protobuf::int32 size; (void)size;
-  int depth; (void)depth;
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::ParseFunc parser_till_end; (void)parser_till_end;
-  auto ptr = begin;
-  while (ptr < end) {
-    ptr = ::google::protobuf::io::Parse32(ptr, &tag);
-    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+  _impl_.uuid_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.config_ != nullptr) {
+    delete _impl_.config_;
+  }
+  _impl_.config_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.audio_ != nullptr) {
+    delete _impl_.audio_;
+  }
+  _impl_.audio_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RecognizeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .kaldi_serve.RecognitionConfig config = 1;
-      case 1: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 10) goto handle_unusual;
-        ptr = ::google::protobuf::io::ReadSize(ptr, &size);
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-        parser_till_end = ::kaldi_serve::RecognitionConfig::_InternalParse;
-        object = msg->mutable_config();
-        if (size > end - ptr) goto len_delim_till_end;
-        ptr += size;
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ctx->ParseExactRange(
-            {parser_till_end, object}, ptr - size, ptr));
-        break;
-      }
-      // .kaldi_serve.RecognitionAudio audio = 2;
-      case 2: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 18) goto handle_unusual;
-        ptr = ::google::protobuf::io::ReadSize(ptr, &size);
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-        parser_till_end = ::kaldi_serve::RecognitionAudio::_InternalParse;
-        object = msg->mutable_audio();
-        if (size > end - ptr) goto len_delim_till_end;
-        ptr += size;
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ctx->ParseExactRange(
-            {parser_till_end, object}, ptr - size, ptr));
-        break;
-      }
-      // string uuid = 3;
-      case 3: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 26) goto handle_unusual;
-        ptr = ::google::protobuf::io::ReadSize(ptr, &size);
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-        ctx->extra_parse_data().SetFieldName("kaldi_serve.RecognizeRequest.uuid");
-        object = msg->mutable_uuid();
-        if (size > end - ptr + ::google::protobuf::internal::ParseContext::kSlopBytes) {
-          parser_till_end = ::google::protobuf::internal::GreedyStringParserUTF8;
-          goto string_till_end;
-        }
-        GOOGLE_PROTOBUF_PARSER_ASSERT(::google::protobuf::internal::StringCheckUTF8(ptr, size, ctx));
-        ::google::protobuf::internal::InlineGreedyStringParser(object, ptr, size, ctx);
-        ptr += size;
-        break;
-      }
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->EndGroup(tag);
-          return ptr;
-        }
-        auto res = UnknownFieldParse(tag, {_InternalParse, msg},
-          ptr, end, msg->_internal_metadata_.mutable_unknown_fields(), ctx);
-        ptr = res.first;
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
-        if (res.second) return ptr;
-      }
-    }  // switch
-  }  // while
-  return ptr;
-string_till_end:
-  static_cast<::std::string*>(object)->clear();
-  static_cast<::std::string*>(object)->reserve(size);
-  goto len_delim_till_end;
-len_delim_till_end:
-  return ctx->StoreAndTailCall(ptr, end, {_InternalParse, msg},
-                               {parser_till_end, object}, size);
-}
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool RecognizeRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:kaldi_serve.RecognizeRequest)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .kaldi_serve.RecognitionConfig config = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_config()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_config(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .kaldi_serve.RecognitionAudio audio = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (18 & 0xFF)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_audio()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_audio(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string uuid = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (26 & 0xFF)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_uuid()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->uuid().data(), static_cast<int>(this->uuid().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "kaldi_serve.RecognizeRequest.uuid"));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_uuid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.RecognizeRequest.uuid"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:kaldi_serve.RecognizeRequest)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:kaldi_serve.RecognizeRequest)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void RecognizeRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:kaldi_serve.RecognizeRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* RecognizeRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.RecognizeRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .kaldi_serve.RecognitionConfig config = 1;
-  if (this->has_config()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, HasBitSetters::config(this), output);
+  if (this->_internal_has_config()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::config(this),
+        _Internal::config(this).GetCachedSize(), target, stream);
   }
 
   // .kaldi_serve.RecognitionAudio audio = 2;
-  if (this->has_audio()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, HasBitSetters::audio(this), output);
+  if (this->_internal_has_audio()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::audio(this),
+        _Internal::audio(this).GetCachedSize(), target, stream);
   }
 
   // string uuid = 3;
-  if (this->uuid().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->uuid().data(), static_cast<int>(this->uuid().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_uuid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_uuid().data(), static_cast<int>(this->_internal_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "kaldi_serve.RecognizeRequest.uuid");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->uuid(), output);
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_uuid(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_end:kaldi_serve.RecognizeRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.RecognizeRequest)
+  return target;
 }
 
-::google::protobuf::uint8* RecognizeRequest::InternalSerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.RecognizeRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+size_t RecognizeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kaldi_serve.RecognizeRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // string uuid = 3;
+  if (!this->_internal_uuid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_uuid());
+  }
+
   // .kaldi_serve.RecognitionConfig config = 1;
-  if (this->has_config()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, HasBitSetters::config(this), target);
+  if (this->_internal_has_config()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.config_);
   }
 
   // .kaldi_serve.RecognitionAudio audio = 2;
-  if (this->has_audio()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, HasBitSetters::audio(this), target);
+  if (this->_internal_has_audio()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.audio_);
   }
 
-  // string uuid = 3;
-  if (this->uuid().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->uuid().data(), static_cast<int>(this->uuid().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "kaldi_serve.RecognizeRequest.uuid");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->uuid(), target);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RecognizeRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RecognizeRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RecognizeRequest::GetClassData() const { return &_class_data_; }
+
+
+void RecognizeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RecognizeRequest*>(&to_msg);
+  auto& from = static_cast<const RecognizeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.RecognizeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uuid().empty()) {
+    _this->_internal_set_uuid(from._internal_uuid());
+  }
+  if (from._internal_has_config()) {
+    _this->_internal_mutable_config()->::kaldi_serve::RecognitionConfig::MergeFrom(
+        from._internal_config());
+  }
+  if (from._internal_has_audio()) {
+    _this->_internal_mutable_audio()->::kaldi_serve::RecognitionAudio::MergeFrom(
+        from._internal_audio());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RecognizeRequest::CopyFrom(const RecognizeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kaldi_serve.RecognizeRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RecognizeRequest::IsInitialized() const {
+  return true;
+}
+
+void RecognizeRequest::InternalSwap(RecognizeRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.uuid_, lhs_arena,
+      &other->_impl_.uuid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RecognizeRequest, _impl_.audio_)
+      + sizeof(RecognizeRequest::_impl_.audio_)
+      - PROTOBUF_FIELD_OFFSET(RecognizeRequest, _impl_.config_)>(
+          reinterpret_cast<char*>(&_impl_.config_),
+          reinterpret_cast<char*>(&other->_impl_.config_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RecognizeRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[0]);
+}
+
+// ===================================================================
+
+class RecognizeResponse::_Internal {
+ public:
+  static const ::kaldi_serve::SearchParams& search_params(const RecognizeResponse* msg);
+};
+
+const ::kaldi_serve::SearchParams&
+RecognizeResponse::_Internal::search_params(const RecognizeResponse* msg) {
+  return *msg->_impl_.search_params_;
+}
+RecognizeResponse::RecognizeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.RecognizeResponse)
+}
+RecognizeResponse::RecognizeResponse(const RecognizeResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RecognizeResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){from._impl_.results_}
+    , decltype(_impl_.search_params_){nullptr}
+    , decltype(_impl_.first_pass_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_search_params()) {
+    _this->_impl_.search_params_ = new ::kaldi_serve::SearchParams(*from._impl_.search_params_);
+  }
+  _this->_impl_.first_pass_ = from._impl_.first_pass_;
+  // @@protoc_insertion_point(copy_constructor:kaldi_serve.RecognizeResponse)
+}
+
+inline void RecognizeResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){arena}
+    , decltype(_impl_.search_params_){nullptr}
+    , decltype(_impl_.first_pass_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RecognizeResponse::~RecognizeResponse() {
+  // @@protoc_insertion_point(destructor:kaldi_serve.RecognizeResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+inline void RecognizeResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.results_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.search_params_;
+}
+
+void RecognizeResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RecognizeResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:kaldi_serve.RecognizeResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.results_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.search_params_ != nullptr) {
+    delete _impl_.search_params_;
   }
-  // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.RecognizeRequest)
+  _impl_.search_params_ = nullptr;
+  _impl_.first_pass_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RecognizeResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .kaldi_serve.SpeechRecognitionResult results = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_results(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .kaldi_serve.SearchParams search_params = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_search_params(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool first_pass = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.first_pass_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RecognizeResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.RecognizeResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .kaldi_serve.SpeechRecognitionResult results = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_results_size()); i < n; i++) {
+    const auto& repfield = this->_internal_results(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .kaldi_serve.SearchParams search_params = 2;
+  if (this->_internal_has_search_params()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::search_params(this),
+        _Internal::search_params(this).GetCachedSize(), target, stream);
+  }
+
+  // bool first_pass = 3;
+  if (this->_internal_first_pass() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_first_pass(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.RecognizeResponse)
   return target;
 }
 
-size_t RecognizeRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:kaldi_serve.RecognizeRequest)
+size_t RecognizeResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kaldi_serve.RecognizeResponse)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string uuid = 3;
-  if (this->uuid().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->uuid());
+  // repeated .kaldi_serve.SpeechRecognitionResult results = 1;
+  total_size += 1UL * this->_internal_results_size();
+  for (const auto& msg : this->_impl_.results_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // .kaldi_serve.RecognitionConfig config = 1;
-  if (this->has_config()) {
+  // .kaldi_serve.SearchParams search_params = 2;
+  if (this->_internal_has_search_params()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *config_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.search_params_);
   }
 
-  // .kaldi_serve.RecognitionAudio audio = 2;
-  if (this->has_audio()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *audio_);
+  // bool first_pass = 3;
+  if (this->_internal_first_pass() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RecognizeResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RecognizeResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RecognizeResponse::GetClassData() const { return &_class_data_; }
+
+
+void RecognizeResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RecognizeResponse*>(&to_msg);
+  auto& from = static_cast<const RecognizeResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.RecognizeResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.results_.MergeFrom(from._impl_.results_);
+  if (from._internal_has_search_params()) {
+    _this->_internal_mutable_search_params()->::kaldi_serve::SearchParams::MergeFrom(
+        from._internal_search_params());
+  }
+  if (from._internal_first_pass() != 0) {
+    _this->_internal_set_first_pass(from._internal_first_pass());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RecognizeResponse::CopyFrom(const RecognizeResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kaldi_serve.RecognizeResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RecognizeResponse::IsInitialized() const {
+  return true;
+}
+
+void RecognizeResponse::InternalSwap(RecognizeResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.results_.InternalSwap(&other->_impl_.results_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RecognizeResponse, _impl_.first_pass_)
+      + sizeof(RecognizeResponse::_impl_.first_pass_)
+      - PROTOBUF_FIELD_OFFSET(RecognizeResponse, _impl_.search_params_)>(
+          reinterpret_cast<char*>(&_impl_.search_params_),
+          reinterpret_cast<char*>(&other->_impl_.search_params_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RecognizeResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[1]);
+}
+
+// ===================================================================
+
+class SearchParams::_Internal {
+ public:
+};
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+SearchParams::SearchParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.SearchParams)
+}
+SearchParams::SearchParams(const SearchParams& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SearchParams* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.beam_){}
+    , decltype(_impl_.max_active_){}
+    , decltype(_impl_.lattice_beam_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.beam_, &from._impl_.beam_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lattice_beam_) -
+    reinterpret_cast<char*>(&_impl_.beam_)) + sizeof(_impl_.lattice_beam_));
+  // @@protoc_insertion_point(copy_constructor:kaldi_serve.SearchParams)
+}
+
+inline void SearchParams::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.beam_){0}
+    , decltype(_impl_.max_active_){0}
+    , decltype(_impl_.lattice_beam_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-void RecognizeRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:kaldi_serve.RecognizeRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RecognizeRequest* source =
-      ::google::protobuf::DynamicCastToGenerated<RecognizeRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kaldi_serve.RecognizeRequest)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:kaldi_serve.RecognizeRequest)
-    MergeFrom(*source);
+SearchParams::~SearchParams() {
+  // @@protoc_insertion_point(destructor:kaldi_serve.SearchParams)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
+
+inline void SearchParams::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SearchParams::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void RecognizeRequest::MergeFrom(const RecognizeRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.RecognizeRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void SearchParams::Clear() {
+// @@protoc_insertion_point(message_clear_start:kaldi_serve.SearchParams)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (from.uuid().size() > 0) {
+  ::memset(&_impl_.beam_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.lattice_beam_) -
+      reinterpret_cast<char*>(&_impl_.beam_)) + sizeof(_impl_.lattice_beam_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
 
-    uuid_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.uuid_);
+const char* SearchParams::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // float beam = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.beam_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 max_active = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.max_active_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // float lattice_beam = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.lattice_beam_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SearchParams::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.SearchParams)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // float beam = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_beam = this->_internal_beam();
+  uint32_t raw_beam;
+  memcpy(&raw_beam, &tmp_beam, sizeof(tmp_beam));
+  if (raw_beam != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_beam(), target);
   }
-  if (from.has_config()) {
-    mutable_config()->::kaldi_serve::RecognitionConfig::MergeFrom(from.config());
+
+  // int32 max_active = 2;
+  if (this->_internal_max_active() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_max_active(), target);
   }
-  if (from.has_audio()) {
-    mutable_audio()->::kaldi_serve::RecognitionAudio::MergeFrom(from.audio());
+
+  // float lattice_beam = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_lattice_beam = this->_internal_lattice_beam();
+  uint32_t raw_lattice_beam;
+  memcpy(&raw_lattice_beam, &tmp_lattice_beam, sizeof(tmp_lattice_beam));
+  if (raw_lattice_beam != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_lattice_beam(), target);
   }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.SearchParams)
+  return target;
 }
 
-void RecognizeRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:kaldi_serve.RecognizeRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+size_t SearchParams::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kaldi_serve.SearchParams)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // float beam = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_beam = this->_internal_beam();
+  uint32_t raw_beam;
+  memcpy(&raw_beam, &tmp_beam, sizeof(tmp_beam));
+  if (raw_beam != 0) {
+    total_size += 1 + 4;
+  }
+
+  // int32 max_active = 2;
+  if (this->_internal_max_active() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_active());
+  }
+
+  // float lattice_beam = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_lattice_beam = this->_internal_lattice_beam();
+  uint32_t raw_lattice_beam;
+  memcpy(&raw_lattice_beam, &tmp_lattice_beam, sizeof(tmp_lattice_beam));
+  if (raw_lattice_beam != 0) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RecognizeRequest::CopyFrom(const RecognizeRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:kaldi_serve.RecognizeRequest)
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SearchParams::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SearchParams::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SearchParams::GetClassData() const { return &_class_data_; }
+
+
+void SearchParams::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SearchParams*>(&to_msg);
+  auto& from = static_cast<const SearchParams&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.SearchParams)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_beam = from._internal_beam();
+  uint32_t raw_beam;
+  memcpy(&raw_beam, &tmp_beam, sizeof(tmp_beam));
+  if (raw_beam != 0) {
+    _this->_internal_set_beam(from._internal_beam());
+  }
+  if (from._internal_max_active() != 0) {
+    _this->_internal_set_max_active(from._internal_max_active());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_lattice_beam = from._internal_lattice_beam();
+  uint32_t raw_lattice_beam;
+  memcpy(&raw_lattice_beam, &tmp_lattice_beam, sizeof(tmp_lattice_beam));
+  if (raw_lattice_beam != 0) {
+    _this->_internal_set_lattice_beam(from._internal_lattice_beam());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SearchParams::CopyFrom(const SearchParams& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kaldi_serve.SearchParams)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool RecognizeRequest::IsInitialized() const {
+bool SearchParams::IsInitialized() const {
   return true;
 }
 
-void RecognizeRequest::Swap(RecognizeRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void RecognizeRequest::InternalSwap(RecognizeRequest* other) {
+void SearchParams::InternalSwap(SearchParams* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  uuid_.Swap(&other->uuid_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(config_, other->config_);
-  swap(audio_, other->audio_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SearchParams, _impl_.lattice_beam_)
+      + sizeof(SearchParams::_impl_.lattice_beam_)
+      - PROTOBUF_FIELD_OFFSET(SearchParams, _impl_.beam_)>(
+          reinterpret_cast<char*>(&_impl_.beam_),
+          reinterpret_cast<char*>(&other->_impl_.beam_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SearchParams::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[2]);
+}
+
+// ===================================================================
+
+class MetricsRequest::_Internal {
+ public:
+};
+
+MetricsRequest::MetricsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.MetricsRequest)
+}
+MetricsRequest::MetricsRequest(const MetricsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  MetricsRequest* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:kaldi_serve.MetricsRequest)
 }
 
-::google::protobuf::Metadata RecognizeRequest::GetMetadata() const {
-  ::google::protobuf::internal::AssignDescriptors(&::assign_descriptors_table_kaldi_5fserve_2eproto);
-  return ::file_level_metadata_kaldi_5fserve_2eproto[kIndexInFileMessages];
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetricsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetricsRequest::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata MetricsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[3]);
 }
 
+// ===================================================================
+
+MetricsResponse_MetricsEntry_DoNotUse::MetricsResponse_MetricsEntry_DoNotUse() {}
+MetricsResponse_MetricsEntry_DoNotUse::MetricsResponse_MetricsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MetricsResponse_MetricsEntry_DoNotUse::MergeFrom(const MetricsResponse_MetricsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MetricsResponse_MetricsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[4]);
+}
 
 // ===================================================================
 
-void RecognizeResponse::InitAsDefaultInstance() {
-}
-class RecognizeResponse::HasBitSetters {
+class MetricsResponse::_Internal {
  public:
 };
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int RecognizeResponse::kResultsFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-RecognizeResponse::RecognizeResponse()
-  : ::google::protobuf::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:kaldi_serve.RecognizeResponse)
-}
-RecognizeResponse::RecognizeResponse(const RecognizeResponse& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(nullptr),
-      results_(from.results_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:kaldi_serve.RecognizeResponse)
-}
-
-void RecognizeResponse::SharedCtor() {
-  ::google::protobuf::internal::InitSCC(
-      &scc_info_RecognizeResponse_kaldi_5fserve_2eproto.base);
+MetricsResponse::MetricsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &MetricsResponse::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.MetricsResponse)
+}
+MetricsResponse::MetricsResponse(const MetricsResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetricsResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.metrics_)*/{}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.metrics_.MergeFrom(from._impl_.metrics_);
+  // @@protoc_insertion_point(copy_constructor:kaldi_serve.MetricsResponse)
+}
+
+inline void MetricsResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.metrics_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-RecognizeResponse::~RecognizeResponse() {
-  // @@protoc_insertion_point(destructor:kaldi_serve.RecognizeResponse)
+MetricsResponse::~MetricsResponse() {
+  // @@protoc_insertion_point(destructor:kaldi_serve.MetricsResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
   SharedDtor();
 }
 
-void RecognizeResponse::SharedDtor() {
+inline void MetricsResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.metrics_.Destruct();
+  _impl_.metrics_.~MapField();
 }
 
-void RecognizeResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void MetricsResponse::ArenaDtor(void* object) {
+  MetricsResponse* _this = reinterpret_cast< MetricsResponse* >(object);
+  _this->_impl_.metrics_.Destruct();
 }
-const RecognizeResponse& RecognizeResponse::default_instance() {
-  ::google::protobuf::internal::InitSCC(&::scc_info_RecognizeResponse_kaldi_5fserve_2eproto.base);
-  return *internal_default_instance();
+void MetricsResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void RecognizeResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:kaldi_serve.RecognizeResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void MetricsResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:kaldi_serve.MetricsResponse)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  results_.Clear();
-  _internal_metadata_.Clear();
-}
-
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* RecognizeResponse::_InternalParse(const char* begin, const char* end, void* object,
-                  ::google::protobuf::internal::ParseContext* ctx) {
-  auto msg = static_cast<RecognizeResponse*>(object);
-  ::google::protobuf::int32 size; (void)size;
-  int depth; (void)depth;
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::ParseFunc parser_till_end; (void)parser_till_end;
-  auto ptr = begin;
-  while (ptr < end) {
-    ptr = ::google::protobuf::io::Parse32(ptr, &tag);
-    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+  _impl_.metrics_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetricsResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .kaldi_serve.SpeechRecognitionResult results = 1;
-      case 1: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 10) goto handle_unusual;
-        do {
-          ptr = ::google::protobuf::io::ReadSize(ptr, &size);
-          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-          parser_till_end = ::kaldi_serve::SpeechRecognitionResult::_InternalParse;
-          object = msg->add_results();
-          if (size > end - ptr) goto len_delim_till_end;
-          ptr += size;
-          GOOGLE_PROTOBUF_PARSER_ASSERT(ctx->ParseExactRange(
-              {parser_till_end, object}, ptr - size, ptr));
-          if (ptr >= end) break;
-        } while ((::google::protobuf::io::UnalignedLoad<::google::protobuf::uint64>(ptr) & 255) == 10 && (ptr += 1));
-        break;
-      }
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->EndGroup(tag);
-          return ptr;
-        }
-        auto res = UnknownFieldParse(tag, {_InternalParse, msg},
-          ptr, end, msg->_internal_metadata_.mutable_unknown_fields(), ctx);
-        ptr = res.first;
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
-        if (res.second) return ptr;
-      }
+      // map<string, double> metrics = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.metrics_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
+message_done:
   return ptr;
-len_delim_till_end:
-  return ctx->StoreAndTailCall(ptr, end, {_InternalParse, msg},
-                               {parser_till_end, object}, size);
-}
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool RecognizeResponse::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:kaldi_serve.RecognizeResponse)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .kaldi_serve.SpeechRecognitionResult results = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-                input, add_results()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:kaldi_serve.RecognizeResponse)
-  return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:kaldi_serve.RecognizeResponse)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-
-void RecognizeResponse::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:kaldi_serve.RecognizeResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // repeated .kaldi_serve.SpeechRecognitionResult results = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->results_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1,
-      this->results(static_cast<int>(i)),
-      output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:kaldi_serve.RecognizeResponse)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* RecognizeResponse::InternalSerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.RecognizeResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* MetricsResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.MetricsResponse)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .kaldi_serve.SpeechRecognitionResult results = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->results_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, this->results(static_cast<int>(i)), target);
+  // map<string, double> metrics = 1;
+  if (!this->_internal_metrics().empty()) {
+    using MapType = ::_pb::Map<std::string, double>;
+    using WireHelper = MetricsResponse_MetricsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_metrics();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "kaldi_serve.MetricsResponse.MetricsEntry.key");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.RecognizeResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.MetricsResponse)
   return target;
 }
 
-size_t RecognizeResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:kaldi_serve.RecognizeResponse)
+size_t MetricsResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kaldi_serve.MetricsResponse)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .kaldi_serve.SpeechRecognitionResult results = 1;
-  {
-    unsigned int count = static_cast<unsigned int>(this->results_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->results(static_cast<int>(i)));
-    }
+  // map<string, double> metrics = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_metrics_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, double >::const_iterator
+      it = this->_internal_metrics().begin();
+      it != this->_internal_metrics().end(); ++it) {
+    total_size += MetricsResponse_MetricsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RecognizeResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:kaldi_serve.RecognizeResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RecognizeResponse* source =
-      ::google::protobuf::DynamicCastToGenerated<RecognizeResponse>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kaldi_serve.RecognizeResponse)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:kaldi_serve.RecognizeResponse)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetricsResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetricsResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetricsResponse::GetClassData() const { return &_class_data_; }
 
-void RecognizeResponse::MergeFrom(const RecognizeResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.RecognizeResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  results_.MergeFrom(from.results_);
-}
+void MetricsResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetricsResponse*>(&to_msg);
+  auto& from = static_cast<const MetricsResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.MetricsResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void RecognizeResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:kaldi_serve.RecognizeResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.metrics_.MergeFrom(from._impl_.metrics_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void RecognizeResponse::CopyFrom(const RecognizeResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:kaldi_serve.RecognizeResponse)
+void MetricsResponse::CopyFrom(const MetricsResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kaldi_serve.MetricsResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool RecognizeResponse::IsInitialized() const {
+bool MetricsResponse::IsInitialized() const {
   return true;
 }
 
-void RecognizeResponse::Swap(RecognizeResponse* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void RecognizeResponse::InternalSwap(RecognizeResponse* other) {
+void MetricsResponse::InternalSwap(MetricsResponse* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  CastToBase(&results_)->InternalSwap(CastToBase(&other->results_));
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.metrics_.InternalSwap(&other->_impl_.metrics_);
 }
 
-::google::protobuf::Metadata RecognizeResponse::GetMetadata() const {
-  ::google::protobuf::internal::AssignDescriptors(&::assign_descriptors_table_kaldi_5fserve_2eproto);
-  return ::file_level_metadata_kaldi_5fserve_2eproto[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata MetricsResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[5]);
 }
 
-
 // ===================================================================
 
-void RecognitionConfig::InitAsDefaultInstance() {
-}
-class RecognitionConfig::HasBitSetters {
+class RecognitionConfig::_Internal {
  public:
 };
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int RecognitionConfig::kEncodingFieldNumber;
-const int RecognitionConfig::kSampleRateHertzFieldNumber;
-const int RecognitionConfig::kLanguageCodeFieldNumber;
-const int RecognitionConfig::kMaxAlternativesFieldNumber;
-const int RecognitionConfig::kPunctuationFieldNumber;
-const int RecognitionConfig::kSpeechContextsFieldNumber;
-const int RecognitionConfig::kAudioChannelCountFieldNumber;
-const int RecognitionConfig::kModelFieldNumber;
-const int RecognitionConfig::kRawFieldNumber;
-const int RecognitionConfig::kDataBytesFieldNumber;
-const int RecognitionConfig::kWordLevelFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-RecognitionConfig::RecognitionConfig()
-  : ::google::protobuf::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:kaldi_serve.RecognitionConfig)
+RecognitionConfig::RecognitionConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.RecognitionConfig)
 }
 RecognitionConfig::RecognitionConfig(const RecognitionConfig& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(nullptr),
-      speech_contexts_(from.speech_contexts_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  language_code_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.language_code().size() > 0) {
-    language_code_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.language_code_);
-  }
-  model_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.model().size() > 0) {
-    model_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.model_);
-  }
-  ::memcpy(&encoding_, &from.encoding_,
-    static_cast<size_t>(reinterpret_cast<char*>(&data_bytes_) -
-    reinterpret_cast<char*>(&encoding_)) + sizeof(data_bytes_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RecognitionConfig* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.speech_contexts_){from._impl_.speech_contexts_}
+    , decltype(_impl_.language_code_){}
+    , decltype(_impl_.model_){}
+    , decltype(_impl_.graph_){}
+    , decltype(_impl_.encoding_){}
+    , decltype(_impl_.sample_rate_hertz_){}
+    , decltype(_impl_.max_alternatives_){}
+    , decltype(_impl_.audio_channel_count_){}
+    , decltype(_impl_.punctuation_){}
+    , decltype(_impl_.raw_){}
+    , decltype(_impl_.word_level_){}
+    , decltype(_impl_.two_pass_){}
+    , decltype(_impl_.data_bytes_){}
+    , decltype(_impl_.beam_){}
+    , decltype(_impl_.max_active_){}
+    , decltype(_impl_.lattice_beam_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.language_code_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.language_code_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_language_code().empty()) {
+    _this->_impl_.language_code_.Set(from._internal_language_code(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.model_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.model_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_model().empty()) {
+    _this->_impl_.model_.Set(from._internal_model(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.graph_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.graph_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_graph().empty()) {
+    _this->_impl_.graph_.Set(from._internal_graph(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.encoding_, &from._impl_.encoding_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lattice_beam_) -
+    reinterpret_cast<char*>(&_impl_.encoding_)) + sizeof(_impl_.lattice_beam_));
   // @@protoc_insertion_point(copy_constructor:kaldi_serve.RecognitionConfig)
 }
 
-void RecognitionConfig::SharedCtor() {
-  ::google::protobuf::internal::InitSCC(
-      &scc_info_RecognitionConfig_kaldi_5fserve_2eproto.base);
-  language_code_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  model_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&encoding_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&data_bytes_) -
-      reinterpret_cast<char*>(&encoding_)) + sizeof(data_bytes_));
+inline void RecognitionConfig::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.speech_contexts_){arena}
+    , decltype(_impl_.language_code_){}
+    , decltype(_impl_.model_){}
+    , decltype(_impl_.graph_){}
+    , decltype(_impl_.encoding_){0}
+    , decltype(_impl_.sample_rate_hertz_){0}
+    , decltype(_impl_.max_alternatives_){0}
+    , decltype(_impl_.audio_channel_count_){0}
+    , decltype(_impl_.punctuation_){false}
+    , decltype(_impl_.raw_){false}
+    , decltype(_impl_.word_level_){false}
+    , decltype(_impl_.two_pass_){false}
+    , decltype(_impl_.data_bytes_){0}
+    , decltype(_impl_.beam_){0}
+    , decltype(_impl_.max_active_){0}
+    , decltype(_impl_.lattice_beam_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.language_code_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.language_code_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.model_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.model_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.graph_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.graph_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 RecognitionConfig::~RecognitionConfig() {
   // @@protoc_insertion_point(destructor:kaldi_serve.RecognitionConfig)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void RecognitionConfig::SharedDtor() {
-  language_code_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  model_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void RecognitionConfig::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.speech_contexts_.~RepeatedPtrField();
+  _impl_.language_code_.Destroy();
+  _impl_.model_.Destroy();
+  _impl_.graph_.Destroy();
 }
 
 void RecognitionConfig::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const RecognitionConfig& RecognitionConfig::default_instance() {
-  ::google::protobuf::internal::InitSCC(&::scc_info_RecognitionConfig_kaldi_5fserve_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void RecognitionConfig::Clear() {
 // @@protoc_insertion_point(message_clear_start:kaldi_serve.RecognitionConfig)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  speech_contexts_.Clear();
-  language_code_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  model_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&encoding_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&data_bytes_) -
-      reinterpret_cast<char*>(&encoding_)) + sizeof(data_bytes_));
-  _internal_metadata_.Clear();
-}
-
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* RecognitionConfig::_InternalParse(const char* begin, const char* end, void* object,
-                  ::google::protobuf::internal::ParseContext* ctx) {
-  auto msg = static_cast<RecognitionConfig*>(object);
-  ::google::protobuf::int32 size; (void)size;
-  int depth; (void)depth;
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::ParseFunc parser_till_end; (void)parser_till_end;
-  auto ptr = begin;
-  while (ptr < end) {
-    ptr = ::google::protobuf::io::Parse32(ptr, &tag);
-    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+  _impl_.speech_contexts_.Clear();
+  _impl_.language_code_.ClearToEmpty();
+  _impl_.model_.ClearToEmpty();
+  _impl_.graph_.ClearToEmpty();
+  ::memset(&_impl_.encoding_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.lattice_beam_) -
+      reinterpret_cast<char*>(&_impl_.encoding_)) + sizeof(_impl_.lattice_beam_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RecognitionConfig::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .kaldi_serve.RecognitionConfig.AudioEncoding encoding = 1;
-      case 1: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 8) goto handle_unusual;
-        ::google::protobuf::uint64 val = ::google::protobuf::internal::ReadVarint(&ptr);
-        msg->set_encoding(static_cast<::kaldi_serve::RecognitionConfig_AudioEncoding>(val));
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-        break;
-      }
-      // int32 sample_rate_hertz = 2;
-      case 2: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 16) goto handle_unusual;
-        msg->set_sample_rate_hertz(::google::protobuf::internal::ReadVarint(&ptr));
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-        break;
-      }
-      // string language_code = 3;
-      case 3: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 26) goto handle_unusual;
-        ptr = ::google::protobuf::io::ReadSize(ptr, &size);
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-        ctx->extra_parse_data().SetFieldName("kaldi_serve.RecognitionConfig.language_code");
-        object = msg->mutable_language_code();
-        if (size > end - ptr + ::google::protobuf::internal::ParseContext::kSlopBytes) {
-          parser_till_end = ::google::protobuf::internal::GreedyStringParserUTF8;
-          goto string_till_end;
-        }
-        GOOGLE_PROTOBUF_PARSER_ASSERT(::google::protobuf::internal::StringCheckUTF8(ptr, size, ctx));
-        ::google::protobuf::internal::InlineGreedyStringParser(object, ptr, size, ctx);
-        ptr += size;
-        break;
-      }
-      // int32 max_alternatives = 4;
-      case 4: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 32) goto handle_unusual;
-        msg->set_max_alternatives(::google::protobuf::internal::ReadVarint(&ptr));
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-        break;
-      }
-      // bool punctuation = 5;
-      case 5: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 40) goto handle_unusual;
-        msg->set_punctuation(::google::protobuf::internal::ReadVarint(&ptr));
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-        break;
-      }
-      // repeated .kaldi_serve.SpeechContext speech_contexts = 6;
-      case 6: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 50) goto handle_unusual;
-        do {
-          ptr = ::google::protobuf::io::ReadSize(ptr, &size);
-          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-          parser_till_end = ::kaldi_serve::SpeechContext::_InternalParse;
-          object = msg->add_speech_contexts();
-          if (size > end - ptr) goto len_delim_till_end;
-          ptr += size;
-          GOOGLE_PROTOBUF_PARSER_ASSERT(ctx->ParseExactRange(
-              {parser_till_end, object}, ptr - size, ptr));
-          if (ptr >= end) break;
-        } while ((::google::protobuf::io::UnalignedLoad<::google::protobuf::uint64>(ptr) & 255) == 50 && (ptr += 1));
-        break;
-      }
-      // int32 audio_channel_count = 7;
-      case 7: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 56) goto handle_unusual;
-        msg->set_audio_channel_count(::google::protobuf::internal::ReadVarint(&ptr));
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-        break;
-      }
-      // string model = 10;
-      case 10: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 82) goto handle_unusual;
-        ptr = ::google::protobuf::io::ReadSize(ptr, &size);
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-        ctx->extra_parse_data().SetFieldName("kaldi_serve.RecognitionConfig.model");
-        object = msg->mutable_model();
-        if (size > end - ptr + ::google::protobuf::internal::ParseContext::kSlopBytes) {
-          parser_till_end = ::google::protobuf::internal::GreedyStringParserUTF8;
-          goto string_till_end;
-        }
-        GOOGLE_PROTOBUF_PARSER_ASSERT(::google::protobuf::internal::StringCheckUTF8(ptr, size, ctx));
-        ::google::protobuf::internal::InlineGreedyStringParser(object, ptr, size, ctx);
-        ptr += size;
-        break;
-      }
-      // bool raw = 11;
-      case 11: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 88) goto handle_unusual;
-        msg->set_raw(::google::protobuf::internal::ReadVarint(&ptr));
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-        break;
-      }
-      // int32 data_bytes = 12;
-      case 12: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 96) goto handle_unusual;
-        msg->set_data_bytes(::google::protobuf::internal::ReadVarint(&ptr));
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-        break;
-      }
-      // bool word_level = 13;
-      case 13: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 104) goto handle_unusual;
-        msg->set_word_level(::google::protobuf::internal::ReadVarint(&ptr));
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-        break;
-      }
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->EndGroup(tag);
-          return ptr;
-        }
-        auto res = UnknownFieldParse(tag, {_InternalParse, msg},
-          ptr, end, msg->_internal_metadata_.mutable_unknown_fields(), ctx);
-        ptr = res.first;
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
-        if (res.second) return ptr;
-      }
-    }  // switch
-  }  // while
-  return ptr;
-string_till_end:
-  static_cast<::std::string*>(object)->clear();
-  static_cast<::std::string*>(object)->reserve(size);
-  goto len_delim_till_end;
-len_delim_till_end:
-  return ctx->StoreAndTailCall(ptr, end, {_InternalParse, msg},
-                               {parser_till_end, object}, size);
-}
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool RecognitionConfig::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:kaldi_serve.RecognitionConfig)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .kaldi_serve.RecognitionConfig.AudioEncoding encoding = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (8 & 0xFF)) {
-          int value = 0;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_encoding(static_cast< ::kaldi_serve::RecognitionConfig_AudioEncoding >(value));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_encoding(static_cast<::kaldi_serve::RecognitionConfig_AudioEncoding>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 sample_rate_hertz = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (16 & 0xFF)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &sample_rate_hertz_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.sample_rate_hertz_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string language_code = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (26 & 0xFF)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_language_code()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->language_code().data(), static_cast<int>(this->language_code().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "kaldi_serve.RecognitionConfig.language_code"));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_language_code();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.RecognitionConfig.language_code"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 max_alternatives = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (32 & 0xFF)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &max_alternatives_)));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.max_alternatives_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bool punctuation = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (40 & 0xFF)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &punctuation_)));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.punctuation_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // repeated .kaldi_serve.SpeechContext speech_contexts = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (50 & 0xFF)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-                input, add_speech_contexts()));
-        } else {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_speech_contexts(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 audio_channel_count = 7;
-      case 7: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (56 & 0xFF)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &audio_channel_count_)));
-        } else {
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.audio_channel_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string model = 10;
-      case 10: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (82 & 0xFF)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_model()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->model().data(), static_cast<int>(this->model().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "kaldi_serve.RecognitionConfig.model"));
-        } else {
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_model();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.RecognitionConfig.model"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bool raw = 11;
-      case 11: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (88 & 0xFF)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &raw_)));
-        } else {
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.raw_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 data_bytes = 12;
-      case 12: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (96 & 0xFF)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &data_bytes_)));
-        } else {
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.data_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bool word_level = 13;
-      case 13: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (104 & 0xFF)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &word_level_)));
-        } else {
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _impl_.word_level_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      // float beam = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 117)) {
+          _impl_.beam_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 max_active = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _impl_.max_active_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // float lattice_beam = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 133)) {
+          _impl_.lattice_beam_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool two_pass = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 136)) {
+          _impl_.two_pass_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string graph = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          auto str = _internal_mutable_graph();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.RecognitionConfig.graph"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:kaldi_serve.RecognitionConfig)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:kaldi_serve.RecognitionConfig)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void RecognitionConfig::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:kaldi_serve.RecognitionConfig)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* RecognitionConfig::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.RecognitionConfig)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .kaldi_serve.RecognitionConfig.AudioEncoding encoding = 1;
-  if (this->encoding() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->encoding(), output);
+  if (this->_internal_encoding() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_encoding(), target);
   }
 
   // int32 sample_rate_hertz = 2;
-  if (this->sample_rate_hertz() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->sample_rate_hertz(), output);
+  if (this->_internal_sample_rate_hertz() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_sample_rate_hertz(), target);
   }
 
   // string language_code = 3;
-  if (this->language_code().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->language_code().data(), static_cast<int>(this->language_code().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_language_code().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_language_code().data(), static_cast<int>(this->_internal_language_code().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "kaldi_serve.RecognitionConfig.language_code");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->language_code(), output);
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_language_code(), target);
   }
 
   // int32 max_alternatives = 4;
-  if (this->max_alternatives() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(4, this->max_alternatives(), output);
+  if (this->_internal_max_alternatives() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_max_alternatives(), target);
   }
 
   // bool punctuation = 5;
-  if (this->punctuation() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(5, this->punctuation(), output);
+  if (this->_internal_punctuation() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_punctuation(), target);
   }
 
   // repeated .kaldi_serve.SpeechContext speech_contexts = 6;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->speech_contexts_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6,
-      this->speech_contexts(static_cast<int>(i)),
-      output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_speech_contexts_size()); i < n; i++) {
+    const auto& repfield = this->_internal_speech_contexts(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // int32 audio_channel_count = 7;
-  if (this->audio_channel_count() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(7, this->audio_channel_count(), output);
+  if (this->_internal_audio_channel_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_audio_channel_count(), target);
   }
 
   // string model = 10;
-  if (this->model().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->model().data(), static_cast<int>(this->model().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_model().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_model().data(), static_cast<int>(this->_internal_model().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "kaldi_serve.RecognitionConfig.model");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      10, this->model(), output);
+    target = stream->WriteStringMaybeAliased(
+        10, this->_internal_model(), target);
   }
 
   // bool raw = 11;
-  if (this->raw() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(11, this->raw(), output);
+  if (this->_internal_raw() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(11, this->_internal_raw(), target);
   }
 
   // int32 data_bytes = 12;
-  if (this->data_bytes() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(12, this->data_bytes(), output);
+  if (this->_internal_data_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(12, this->_internal_data_bytes(), target);
   }
 
   // bool word_level = 13;
-  if (this->word_level() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(13, this->word_level(), output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:kaldi_serve.RecognitionConfig)
-}
-
-::google::protobuf::uint8* RecognitionConfig::InternalSerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.RecognitionConfig)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // .kaldi_serve.RecognitionConfig.AudioEncoding encoding = 1;
-  if (this->encoding() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->encoding(), target);
-  }
-
-  // int32 sample_rate_hertz = 2;
-  if (this->sample_rate_hertz() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->sample_rate_hertz(), target);
-  }
-
-  // string language_code = 3;
-  if (this->language_code().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->language_code().data(), static_cast<int>(this->language_code().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "kaldi_serve.RecognitionConfig.language_code");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->language_code(), target);
-  }
-
-  // int32 max_alternatives = 4;
-  if (this->max_alternatives() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(4, this->max_alternatives(), target);
-  }
-
-  // bool punctuation = 5;
-  if (this->punctuation() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(5, this->punctuation(), target);
-  }
-
-  // repeated .kaldi_serve.SpeechContext speech_contexts = 6;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->speech_contexts_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        6, this->speech_contexts(static_cast<int>(i)), target);
+  if (this->_internal_word_level() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(13, this->_internal_word_level(), target);
   }
 
-  // int32 audio_channel_count = 7;
-  if (this->audio_channel_count() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(7, this->audio_channel_count(), target);
+  // float beam = 14;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_beam = this->_internal_beam();
+  uint32_t raw_beam;
+  memcpy(&raw_beam, &tmp_beam, sizeof(tmp_beam));
+  if (raw_beam != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(14, this->_internal_beam(), target);
   }
 
-  // string model = 10;
-  if (this->model().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->model().data(), static_cast<int>(this->model().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "kaldi_serve.RecognitionConfig.model");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        10, this->model(), target);
+  // int32 max_active = 15;
+  if (this->_internal_max_active() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(15, this->_internal_max_active(), target);
   }
 
-  // bool raw = 11;
-  if (this->raw() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(11, this->raw(), target);
+  // float lattice_beam = 16;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_lattice_beam = this->_internal_lattice_beam();
+  uint32_t raw_lattice_beam;
+  memcpy(&raw_lattice_beam, &tmp_lattice_beam, sizeof(tmp_lattice_beam));
+  if (raw_lattice_beam != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(16, this->_internal_lattice_beam(), target);
   }
 
-  // int32 data_bytes = 12;
-  if (this->data_bytes() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(12, this->data_bytes(), target);
+  // bool two_pass = 17;
+  if (this->_internal_two_pass() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(17, this->_internal_two_pass(), target);
   }
 
-  // bool word_level = 13;
-  if (this->word_level() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(13, this->word_level(), target);
+  // string graph = 18;
+  if (!this->_internal_graph().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_graph().data(), static_cast<int>(this->_internal_graph().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kaldi_serve.RecognitionConfig.graph");
+    target = stream->WriteStringMaybeAliased(
+        18, this->_internal_graph(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.RecognitionConfig)
   return target;
@@ -1660,156 +1967,180 @@ size_t RecognitionConfig::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:kaldi_serve.RecognitionConfig)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .kaldi_serve.SpeechContext speech_contexts = 6;
-  {
-    unsigned int count = static_cast<unsigned int>(this->speech_contexts_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->speech_contexts(static_cast<int>(i)));
-    }
+  total_size += 1UL * this->_internal_speech_contexts_size();
+  for (const auto& msg : this->_impl_.speech_contexts_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // string language_code = 3;
-  if (this->language_code().size() > 0) {
+  if (!this->_internal_language_code().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->language_code());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_language_code());
   }
 
   // string model = 10;
-  if (this->model().size() > 0) {
+  if (!this->_internal_model().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->model());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_model());
+  }
+
+  // string graph = 18;
+  if (!this->_internal_graph().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_graph());
   }
 
   // .kaldi_serve.RecognitionConfig.AudioEncoding encoding = 1;
-  if (this->encoding() != 0) {
+  if (this->_internal_encoding() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->encoding());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_encoding());
   }
 
   // int32 sample_rate_hertz = 2;
-  if (this->sample_rate_hertz() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->sample_rate_hertz());
+  if (this->_internal_sample_rate_hertz() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_sample_rate_hertz());
   }
 
   // int32 max_alternatives = 4;
-  if (this->max_alternatives() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->max_alternatives());
+  if (this->_internal_max_alternatives() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_alternatives());
   }
 
   // int32 audio_channel_count = 7;
-  if (this->audio_channel_count() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->audio_channel_count());
+  if (this->_internal_audio_channel_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_audio_channel_count());
   }
 
   // bool punctuation = 5;
-  if (this->punctuation() != 0) {
+  if (this->_internal_punctuation() != 0) {
     total_size += 1 + 1;
   }
 
   // bool raw = 11;
-  if (this->raw() != 0) {
+  if (this->_internal_raw() != 0) {
     total_size += 1 + 1;
   }
 
   // bool word_level = 13;
-  if (this->word_level() != 0) {
+  if (this->_internal_word_level() != 0) {
     total_size += 1 + 1;
   }
 
+  // bool two_pass = 17;
+  if (this->_internal_two_pass() != 0) {
+    total_size += 2 + 1;
+  }
+
   // int32 data_bytes = 12;
-  if (this->data_bytes() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->data_bytes());
+  if (this->_internal_data_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_data_bytes());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // float beam = 14;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_beam = this->_internal_beam();
+  uint32_t raw_beam;
+  memcpy(&raw_beam, &tmp_beam, sizeof(tmp_beam));
+  if (raw_beam != 0) {
+    total_size += 1 + 4;
+  }
+
+  // int32 max_active = 15;
+  if (this->_internal_max_active() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_active());
+  }
 
-void RecognitionConfig::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:kaldi_serve.RecognitionConfig)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RecognitionConfig* source =
-      ::google::protobuf::DynamicCastToGenerated<RecognitionConfig>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kaldi_serve.RecognitionConfig)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:kaldi_serve.RecognitionConfig)
-    MergeFrom(*source);
+  // float lattice_beam = 16;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_lattice_beam = this->_internal_lattice_beam();
+  uint32_t raw_lattice_beam;
+  memcpy(&raw_lattice_beam, &tmp_lattice_beam, sizeof(tmp_lattice_beam));
+  if (raw_lattice_beam != 0) {
+    total_size += 2 + 4;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RecognitionConfig::MergeFrom(const RecognitionConfig& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.RecognitionConfig)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RecognitionConfig::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RecognitionConfig::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RecognitionConfig::GetClassData() const { return &_class_data_; }
 
-  speech_contexts_.MergeFrom(from.speech_contexts_);
-  if (from.language_code().size() > 0) {
 
-    language_code_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.language_code_);
-  }
-  if (from.model().size() > 0) {
+void RecognitionConfig::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RecognitionConfig*>(&to_msg);
+  auto& from = static_cast<const RecognitionConfig&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.RecognitionConfig)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    model_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.model_);
+  _this->_impl_.speech_contexts_.MergeFrom(from._impl_.speech_contexts_);
+  if (!from._internal_language_code().empty()) {
+    _this->_internal_set_language_code(from._internal_language_code());
   }
-  if (from.encoding() != 0) {
-    set_encoding(from.encoding());
+  if (!from._internal_model().empty()) {
+    _this->_internal_set_model(from._internal_model());
   }
-  if (from.sample_rate_hertz() != 0) {
-    set_sample_rate_hertz(from.sample_rate_hertz());
+  if (!from._internal_graph().empty()) {
+    _this->_internal_set_graph(from._internal_graph());
   }
-  if (from.max_alternatives() != 0) {
-    set_max_alternatives(from.max_alternatives());
+  if (from._internal_encoding() != 0) {
+    _this->_internal_set_encoding(from._internal_encoding());
   }
-  if (from.audio_channel_count() != 0) {
-    set_audio_channel_count(from.audio_channel_count());
+  if (from._internal_sample_rate_hertz() != 0) {
+    _this->_internal_set_sample_rate_hertz(from._internal_sample_rate_hertz());
   }
-  if (from.punctuation() != 0) {
-    set_punctuation(from.punctuation());
+  if (from._internal_max_alternatives() != 0) {
+    _this->_internal_set_max_alternatives(from._internal_max_alternatives());
   }
-  if (from.raw() != 0) {
-    set_raw(from.raw());
+  if (from._internal_audio_channel_count() != 0) {
+    _this->_internal_set_audio_channel_count(from._internal_audio_channel_count());
   }
-  if (from.word_level() != 0) {
-    set_word_level(from.word_level());
+  if (from._internal_punctuation() != 0) {
+    _this->_internal_set_punctuation(from._internal_punctuation());
   }
-  if (from.data_bytes() != 0) {
-    set_data_bytes(from.data_bytes());
+  if (from._internal_raw() != 0) {
+    _this->_internal_set_raw(from._internal_raw());
   }
-}
-
-void RecognitionConfig::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:kaldi_serve.RecognitionConfig)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_word_level() != 0) {
+    _this->_internal_set_word_level(from._internal_word_level());
+  }
+  if (from._internal_two_pass() != 0) {
+    _this->_internal_set_two_pass(from._internal_two_pass());
+  }
+  if (from._internal_data_bytes() != 0) {
+    _this->_internal_set_data_bytes(from._internal_data_bytes());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_beam = from._internal_beam();
+  uint32_t raw_beam;
+  memcpy(&raw_beam, &tmp_beam, sizeof(tmp_beam));
+  if (raw_beam != 0) {
+    _this->_internal_set_beam(from._internal_beam());
+  }
+  if (from._internal_max_active() != 0) {
+    _this->_internal_set_max_active(from._internal_max_active());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_lattice_beam = from._internal_lattice_beam();
+  uint32_t raw_lattice_beam;
+  memcpy(&raw_lattice_beam, &tmp_lattice_beam, sizeof(tmp_lattice_beam));
+  if (raw_lattice_beam != 0) {
+    _this->_internal_set_lattice_beam(from._internal_lattice_beam());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RecognitionConfig::CopyFrom(const RecognitionConfig& from) {
@@ -1823,68 +2154,67 @@ bool RecognitionConfig::IsInitialized() const {
   return true;
 }
 
-void RecognitionConfig::Swap(RecognitionConfig* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void RecognitionConfig::InternalSwap(RecognitionConfig* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  CastToBase(&speech_contexts_)->InternalSwap(CastToBase(&other->speech_contexts_));
-  language_code_.Swap(&other->language_code_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  model_.Swap(&other->model_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(encoding_, other->encoding_);
-  swap(sample_rate_hertz_, other->sample_rate_hertz_);
-  swap(max_alternatives_, other->max_alternatives_);
-  swap(audio_channel_count_, other->audio_channel_count_);
-  swap(punctuation_, other->punctuation_);
-  swap(raw_, other->raw_);
-  swap(word_level_, other->word_level_);
-  swap(data_bytes_, other->data_bytes_);
-}
-
-::google::protobuf::Metadata RecognitionConfig::GetMetadata() const {
-  ::google::protobuf::internal::AssignDescriptors(&::assign_descriptors_table_kaldi_5fserve_2eproto);
-  return ::file_level_metadata_kaldi_5fserve_2eproto[kIndexInFileMessages];
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.speech_contexts_.InternalSwap(&other->_impl_.speech_contexts_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.language_code_, lhs_arena,
+      &other->_impl_.language_code_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.model_, lhs_arena,
+      &other->_impl_.model_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.graph_, lhs_arena,
+      &other->_impl_.graph_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RecognitionConfig, _impl_.lattice_beam_)
+      + sizeof(RecognitionConfig::_impl_.lattice_beam_)
+      - PROTOBUF_FIELD_OFFSET(RecognitionConfig, _impl_.encoding_)>(
+          reinterpret_cast<char*>(&_impl_.encoding_),
+          reinterpret_cast<char*>(&other->_impl_.encoding_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RecognitionConfig::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[6]);
 }
 
-
 // ===================================================================
 
-void RecognitionAudio::InitAsDefaultInstance() {
-  ::kaldi_serve::_RecognitionAudio_default_instance_.content_.UnsafeSetDefault(
-      &::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::kaldi_serve::_RecognitionAudio_default_instance_.uri_.UnsafeSetDefault(
-      &::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-class RecognitionAudio::HasBitSetters {
+class RecognitionAudio::_Internal {
  public:
 };
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int RecognitionAudio::kContentFieldNumber;
-const int RecognitionAudio::kUriFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-RecognitionAudio::RecognitionAudio()
-  : ::google::protobuf::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:kaldi_serve.RecognitionAudio)
+RecognitionAudio::RecognitionAudio(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.RecognitionAudio)
 }
 RecognitionAudio::RecognitionAudio(const RecognitionAudio& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RecognitionAudio* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.audio_source_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   clear_has_audio_source();
   switch (from.audio_source_case()) {
     case kContent: {
-      set_content(from.content());
+      _this->_internal_set_content(from._internal_content());
       break;
     }
     case kUri: {
-      set_uri(from.uri());
+      _this->_internal_set_uri(from._internal_uri());
       break;
     }
     case AUDIO_SOURCE_NOT_SET: {
@@ -1894,242 +2224,140 @@ RecognitionAudio::RecognitionAudio(const RecognitionAudio& from)
   // @@protoc_insertion_point(copy_constructor:kaldi_serve.RecognitionAudio)
 }
 
-void RecognitionAudio::SharedCtor() {
-  ::google::protobuf::internal::InitSCC(
-      &scc_info_RecognitionAudio_kaldi_5fserve_2eproto.base);
+inline void RecognitionAudio::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.audio_source_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
   clear_has_audio_source();
 }
 
 RecognitionAudio::~RecognitionAudio() {
   // @@protoc_insertion_point(destructor:kaldi_serve.RecognitionAudio)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void RecognitionAudio::SharedDtor() {
+inline void RecognitionAudio::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   if (has_audio_source()) {
     clear_audio_source();
   }
 }
 
 void RecognitionAudio::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const RecognitionAudio& RecognitionAudio::default_instance() {
-  ::google::protobuf::internal::InitSCC(&::scc_info_RecognitionAudio_kaldi_5fserve_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void RecognitionAudio::clear_audio_source() {
 // @@protoc_insertion_point(one_of_clear_start:kaldi_serve.RecognitionAudio)
   switch (audio_source_case()) {
     case kContent: {
-      audio_source_.content_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+      _impl_.audio_source_.content_.Destroy();
       break;
     }
     case kUri: {
-      audio_source_.uri_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+      _impl_.audio_source_.uri_.Destroy();
       break;
     }
     case AUDIO_SOURCE_NOT_SET: {
       break;
     }
   }
-  _oneof_case_[0] = AUDIO_SOURCE_NOT_SET;
+  _impl_._oneof_case_[0] = AUDIO_SOURCE_NOT_SET;
 }
 
 
 void RecognitionAudio::Clear() {
 // @@protoc_insertion_point(message_clear_start:kaldi_serve.RecognitionAudio)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   clear_audio_source();
-  _internal_metadata_.Clear();
-}
-
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* RecognitionAudio::_InternalParse(const char* begin, const char* end, void* object,
-                  ::google::protobuf::internal::ParseContext* ctx) {
-  auto msg = static_cast<RecognitionAudio*>(object);
-  ::google::protobuf::int32 size; (void)size;
-  int depth; (void)depth;
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::ParseFunc parser_till_end; (void)parser_till_end;
-  auto ptr = begin;
-  while (ptr < end) {
-    ptr = ::google::protobuf::io::Parse32(ptr, &tag);
-    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RecognitionAudio::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // bytes content = 1;
-      case 1: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 10) goto handle_unusual;
-        ptr = ::google::protobuf::io::ReadSize(ptr, &size);
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-        object = msg->mutable_content();
-        if (size > end - ptr + ::google::protobuf::internal::ParseContext::kSlopBytes) {
-          parser_till_end = ::google::protobuf::internal::GreedyStringParser;
-          goto string_till_end;
-        }
-        GOOGLE_PROTOBUF_PARSER_ASSERT(::google::protobuf::internal::StringCheck(ptr, size, ctx));
-        ::google::protobuf::internal::InlineGreedyStringParser(object, ptr, size, ctx);
-        ptr += size;
-        break;
-      }
-      // string uri = 2;
-      case 2: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 18) goto handle_unusual;
-        ptr = ::google::protobuf::io::ReadSize(ptr, &size);
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-        ctx->extra_parse_data().SetFieldName("kaldi_serve.RecognitionAudio.uri");
-        object = msg->mutable_uri();
-        if (size > end - ptr + ::google::protobuf::internal::ParseContext::kSlopBytes) {
-          parser_till_end = ::google::protobuf::internal::GreedyStringParserUTF8;
-          goto string_till_end;
-        }
-        GOOGLE_PROTOBUF_PARSER_ASSERT(::google::protobuf::internal::StringCheckUTF8(ptr, size, ctx));
-        ::google::protobuf::internal::InlineGreedyStringParser(object, ptr, size, ctx);
-        ptr += size;
-        break;
-      }
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->EndGroup(tag);
-          return ptr;
-        }
-        auto res = UnknownFieldParse(tag, {_InternalParse, msg},
-          ptr, end, msg->_internal_metadata_.mutable_unknown_fields(), ctx);
-        ptr = res.first;
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
-        if (res.second) return ptr;
-      }
-    }  // switch
-  }  // while
-  return ptr;
-string_till_end:
-  static_cast<::std::string*>(object)->clear();
-  static_cast<::std::string*>(object)->reserve(size);
-  goto len_delim_till_end;
-len_delim_till_end:
-  return ctx->StoreAndTailCall(ptr, end, {_InternalParse, msg},
-                               {parser_till_end, object}, size);
-}
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool RecognitionAudio::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:kaldi_serve.RecognitionAudio)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // bytes content = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_content()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_content();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string uri = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (18 & 0xFF)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_uri()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->uri().data(), static_cast<int>(this->uri().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "kaldi_serve.RecognitionAudio.uri"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_uri();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.RecognitionAudio.uri"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:kaldi_serve.RecognitionAudio)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:kaldi_serve.RecognitionAudio)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-
-void RecognitionAudio::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:kaldi_serve.RecognitionAudio)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // bytes content = 1;
-  if (has_content()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      1, this->content(), output);
-  }
-
-  // string uri = 2;
-  if (has_uri()) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->uri().data(), static_cast<int>(this->uri().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "kaldi_serve.RecognitionAudio.uri");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->uri(), output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:kaldi_serve.RecognitionAudio)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* RecognitionAudio::InternalSerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+uint8_t* RecognitionAudio::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.RecognitionAudio)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes content = 1;
-  if (has_content()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        1, this->content(), target);
+  if (_internal_has_content()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_content(), target);
   }
 
   // string uri = 2;
-  if (has_uri()) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->uri().data(), static_cast<int>(this->uri().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (_internal_has_uri()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_uri().data(), static_cast<int>(this->_internal_uri().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "kaldi_serve.RecognitionAudio.uri");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->uri(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_uri(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.RecognitionAudio)
   return target;
@@ -2139,12 +2367,7 @@ size_t RecognitionAudio::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:kaldi_serve.RecognitionAudio)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
@@ -2152,68 +2375,53 @@ size_t RecognitionAudio::ByteSizeLong() const {
     // bytes content = 1;
     case kContent: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->content());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_content());
       break;
     }
     // string uri = 2;
     case kUri: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->uri());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_uri());
       break;
     }
     case AUDIO_SOURCE_NOT_SET: {
       break;
     }
   }
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RecognitionAudio::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:kaldi_serve.RecognitionAudio)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RecognitionAudio* source =
-      ::google::protobuf::DynamicCastToGenerated<RecognitionAudio>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kaldi_serve.RecognitionAudio)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:kaldi_serve.RecognitionAudio)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RecognitionAudio::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RecognitionAudio::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RecognitionAudio::GetClassData() const { return &_class_data_; }
 
-void RecognitionAudio::MergeFrom(const RecognitionAudio& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.RecognitionAudio)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+
+void RecognitionAudio::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RecognitionAudio*>(&to_msg);
+  auto& from = static_cast<const RecognitionAudio&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.RecognitionAudio)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   switch (from.audio_source_case()) {
     case kContent: {
-      set_content(from.content());
+      _this->_internal_set_content(from._internal_content());
       break;
     }
     case kUri: {
-      set_uri(from.uri());
+      _this->_internal_set_uri(from._internal_uri());
       break;
     }
     case AUDIO_SOURCE_NOT_SET: {
       break;
-    }
-  }
-}
-
-void RecognitionAudio::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:kaldi_serve.RecognitionAudio)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RecognitionAudio::CopyFrom(const RecognitionAudio& from) {
@@ -2227,210 +2435,139 @@ bool RecognitionAudio::IsInitialized() const {
   return true;
 }
 
-void RecognitionAudio::Swap(RecognitionAudio* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void RecognitionAudio::InternalSwap(RecognitionAudio* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(audio_source_, other->audio_source_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.audio_source_, other->_impl_.audio_source_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
-::google::protobuf::Metadata RecognitionAudio::GetMetadata() const {
-  ::google::protobuf::internal::AssignDescriptors(&::assign_descriptors_table_kaldi_5fserve_2eproto);
-  return ::file_level_metadata_kaldi_5fserve_2eproto[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata RecognitionAudio::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[7]);
 }
 
-
 // ===================================================================
 
-void SpeechRecognitionResult::InitAsDefaultInstance() {
-}
-class SpeechRecognitionResult::HasBitSetters {
+class SpeechRecognitionResult::_Internal {
  public:
 };
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SpeechRecognitionResult::kAlternativesFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-SpeechRecognitionResult::SpeechRecognitionResult()
-  : ::google::protobuf::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:kaldi_serve.SpeechRecognitionResult)
+SpeechRecognitionResult::SpeechRecognitionResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.SpeechRecognitionResult)
 }
 SpeechRecognitionResult::SpeechRecognitionResult(const SpeechRecognitionResult& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(nullptr),
-      alternatives_(from.alternatives_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SpeechRecognitionResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.alternatives_){from._impl_.alternatives_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:kaldi_serve.SpeechRecognitionResult)
 }
 
-void SpeechRecognitionResult::SharedCtor() {
-  ::google::protobuf::internal::InitSCC(
-      &scc_info_SpeechRecognitionResult_kaldi_5fserve_2eproto.base);
+inline void SpeechRecognitionResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.alternatives_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 SpeechRecognitionResult::~SpeechRecognitionResult() {
   // @@protoc_insertion_point(destructor:kaldi_serve.SpeechRecognitionResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SpeechRecognitionResult::SharedDtor() {
+inline void SpeechRecognitionResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.alternatives_.~RepeatedPtrField();
 }
 
 void SpeechRecognitionResult::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const SpeechRecognitionResult& SpeechRecognitionResult::default_instance() {
-  ::google::protobuf::internal::InitSCC(&::scc_info_SpeechRecognitionResult_kaldi_5fserve_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void SpeechRecognitionResult::Clear() {
 // @@protoc_insertion_point(message_clear_start:kaldi_serve.SpeechRecognitionResult)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  alternatives_.Clear();
-  _internal_metadata_.Clear();
-}
-
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* SpeechRecognitionResult::_InternalParse(const char* begin, const char* end, void* object,
-                  ::google::protobuf::internal::ParseContext* ctx) {
-  auto msg = static_cast<SpeechRecognitionResult*>(object);
-  ::google::protobuf::int32 size; (void)size;
-  int depth; (void)depth;
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::ParseFunc parser_till_end; (void)parser_till_end;
-  auto ptr = begin;
-  while (ptr < end) {
-    ptr = ::google::protobuf::io::Parse32(ptr, &tag);
-    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+  _impl_.alternatives_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SpeechRecognitionResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated .kaldi_serve.SpeechRecognitionAlternative alternatives = 1;
-      case 1: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 10) goto handle_unusual;
-        do {
-          ptr = ::google::protobuf::io::ReadSize(ptr, &size);
-          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-          parser_till_end = ::kaldi_serve::SpeechRecognitionAlternative::_InternalParse;
-          object = msg->add_alternatives();
-          if (size > end - ptr) goto len_delim_till_end;
-          ptr += size;
-          GOOGLE_PROTOBUF_PARSER_ASSERT(ctx->ParseExactRange(
-              {parser_till_end, object}, ptr - size, ptr));
-          if (ptr >= end) break;
-        } while ((::google::protobuf::io::UnalignedLoad<::google::protobuf::uint64>(ptr) & 255) == 10 && (ptr += 1));
-        break;
-      }
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->EndGroup(tag);
-          return ptr;
-        }
-        auto res = UnknownFieldParse(tag, {_InternalParse, msg},
-          ptr, end, msg->_internal_metadata_.mutable_unknown_fields(), ctx);
-        ptr = res.first;
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
-        if (res.second) return ptr;
-      }
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_alternatives(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
+message_done:
   return ptr;
-len_delim_till_end:
-  return ctx->StoreAndTailCall(ptr, end, {_InternalParse, msg},
-                               {parser_till_end, object}, size);
-}
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool SpeechRecognitionResult::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:kaldi_serve.SpeechRecognitionResult)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .kaldi_serve.SpeechRecognitionAlternative alternatives = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-                input, add_alternatives()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:kaldi_serve.SpeechRecognitionResult)
-  return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:kaldi_serve.SpeechRecognitionResult)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-
-void SpeechRecognitionResult::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:kaldi_serve.SpeechRecognitionResult)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // repeated .kaldi_serve.SpeechRecognitionAlternative alternatives = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->alternatives_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1,
-      this->alternatives(static_cast<int>(i)),
-      output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:kaldi_serve.SpeechRecognitionResult)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* SpeechRecognitionResult::InternalSerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+uint8_t* SpeechRecognitionResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.SpeechRecognitionResult)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated .kaldi_serve.SpeechRecognitionAlternative alternatives = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->alternatives_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, this->alternatives(static_cast<int>(i)), target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_alternatives_size()); i < n; i++) {
+    const auto& repfield = this->_internal_alternatives(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.SpeechRecognitionResult)
   return target;
@@ -2440,61 +2577,37 @@ size_t SpeechRecognitionResult::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:kaldi_serve.SpeechRecognitionResult)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .kaldi_serve.SpeechRecognitionAlternative alternatives = 1;
-  {
-    unsigned int count = static_cast<unsigned int>(this->alternatives_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->alternatives(static_cast<int>(i)));
-    }
+  total_size += 1UL * this->_internal_alternatives_size();
+  for (const auto& msg : this->_impl_.alternatives_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SpeechRecognitionResult::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:kaldi_serve.SpeechRecognitionResult)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SpeechRecognitionResult* source =
-      ::google::protobuf::DynamicCastToGenerated<SpeechRecognitionResult>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kaldi_serve.SpeechRecognitionResult)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:kaldi_serve.SpeechRecognitionResult)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SpeechRecognitionResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SpeechRecognitionResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SpeechRecognitionResult::GetClassData() const { return &_class_data_; }
 
-void SpeechRecognitionResult::MergeFrom(const SpeechRecognitionResult& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.SpeechRecognitionResult)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  alternatives_.MergeFrom(from.alternatives_);
-}
+void SpeechRecognitionResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SpeechRecognitionResult*>(&to_msg);
+  auto& from = static_cast<const SpeechRecognitionResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.SpeechRecognitionResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void SpeechRecognitionResult::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:kaldi_serve.SpeechRecognitionResult)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.alternatives_.MergeFrom(from._impl_.alternatives_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SpeechRecognitionResult::CopyFrom(const SpeechRecognitionResult& from) {
@@ -2508,375 +2621,240 @@ bool SpeechRecognitionResult::IsInitialized() const {
   return true;
 }
 
-void SpeechRecognitionResult::Swap(SpeechRecognitionResult* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void SpeechRecognitionResult::InternalSwap(SpeechRecognitionResult* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  CastToBase(&alternatives_)->InternalSwap(CastToBase(&other->alternatives_));
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.alternatives_.InternalSwap(&other->_impl_.alternatives_);
 }
 
-::google::protobuf::Metadata SpeechRecognitionResult::GetMetadata() const {
-  ::google::protobuf::internal::AssignDescriptors(&::assign_descriptors_table_kaldi_5fserve_2eproto);
-  return ::file_level_metadata_kaldi_5fserve_2eproto[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata SpeechRecognitionResult::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[8]);
 }
 
-
 // ===================================================================
 
-void SpeechRecognitionAlternative::InitAsDefaultInstance() {
-}
-class SpeechRecognitionAlternative::HasBitSetters {
+class SpeechRecognitionAlternative::_Internal {
  public:
 };
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SpeechRecognitionAlternative::kTranscriptFieldNumber;
-const int SpeechRecognitionAlternative::kConfidenceFieldNumber;
-const int SpeechRecognitionAlternative::kAmScoreFieldNumber;
-const int SpeechRecognitionAlternative::kLmScoreFieldNumber;
-const int SpeechRecognitionAlternative::kWordsFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-SpeechRecognitionAlternative::SpeechRecognitionAlternative()
-  : ::google::protobuf::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:kaldi_serve.SpeechRecognitionAlternative)
+SpeechRecognitionAlternative::SpeechRecognitionAlternative(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.SpeechRecognitionAlternative)
 }
 SpeechRecognitionAlternative::SpeechRecognitionAlternative(const SpeechRecognitionAlternative& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(nullptr),
-      words_(from.words_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  transcript_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.transcript().size() > 0) {
-    transcript_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.transcript_);
-  }
-  ::memcpy(&confidence_, &from.confidence_,
-    static_cast<size_t>(reinterpret_cast<char*>(&lm_score_) -
-    reinterpret_cast<char*>(&confidence_)) + sizeof(lm_score_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SpeechRecognitionAlternative* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.words_){from._impl_.words_}
+    , decltype(_impl_.transcript_){}
+    , decltype(_impl_.confidence_){}
+    , decltype(_impl_.am_score_){}
+    , decltype(_impl_.lm_score_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.transcript_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.transcript_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_transcript().empty()) {
+    _this->_impl_.transcript_.Set(from._internal_transcript(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.confidence_, &from._impl_.confidence_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lm_score_) -
+    reinterpret_cast<char*>(&_impl_.confidence_)) + sizeof(_impl_.lm_score_));
   // @@protoc_insertion_point(copy_constructor:kaldi_serve.SpeechRecognitionAlternative)
 }
 
-void SpeechRecognitionAlternative::SharedCtor() {
-  ::google::protobuf::internal::InitSCC(
-      &scc_info_SpeechRecognitionAlternative_kaldi_5fserve_2eproto.base);
-  transcript_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&confidence_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&lm_score_) -
-      reinterpret_cast<char*>(&confidence_)) + sizeof(lm_score_));
+inline void SpeechRecognitionAlternative::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.words_){arena}
+    , decltype(_impl_.transcript_){}
+    , decltype(_impl_.confidence_){0}
+    , decltype(_impl_.am_score_){0}
+    , decltype(_impl_.lm_score_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.transcript_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.transcript_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 SpeechRecognitionAlternative::~SpeechRecognitionAlternative() {
   // @@protoc_insertion_point(destructor:kaldi_serve.SpeechRecognitionAlternative)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SpeechRecognitionAlternative::SharedDtor() {
-  transcript_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void SpeechRecognitionAlternative::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.words_.~RepeatedPtrField();
+  _impl_.transcript_.Destroy();
 }
 
 void SpeechRecognitionAlternative::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const SpeechRecognitionAlternative& SpeechRecognitionAlternative::default_instance() {
-  ::google::protobuf::internal::InitSCC(&::scc_info_SpeechRecognitionAlternative_kaldi_5fserve_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void SpeechRecognitionAlternative::Clear() {
 // @@protoc_insertion_point(message_clear_start:kaldi_serve.SpeechRecognitionAlternative)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  words_.Clear();
-  transcript_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&confidence_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&lm_score_) -
-      reinterpret_cast<char*>(&confidence_)) + sizeof(lm_score_));
-  _internal_metadata_.Clear();
-}
-
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* SpeechRecognitionAlternative::_InternalParse(const char* begin, const char* end, void* object,
-                  ::google::protobuf::internal::ParseContext* ctx) {
-  auto msg = static_cast<SpeechRecognitionAlternative*>(object);
-  ::google::protobuf::int32 size; (void)size;
-  int depth; (void)depth;
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::ParseFunc parser_till_end; (void)parser_till_end;
-  auto ptr = begin;
-  while (ptr < end) {
-    ptr = ::google::protobuf::io::Parse32(ptr, &tag);
-    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+  _impl_.words_.Clear();
+  _impl_.transcript_.ClearToEmpty();
+  ::memset(&_impl_.confidence_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.lm_score_) -
+      reinterpret_cast<char*>(&_impl_.confidence_)) + sizeof(_impl_.lm_score_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SpeechRecognitionAlternative::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string transcript = 1;
-      case 1: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 10) goto handle_unusual;
-        ptr = ::google::protobuf::io::ReadSize(ptr, &size);
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-        ctx->extra_parse_data().SetFieldName("kaldi_serve.SpeechRecognitionAlternative.transcript");
-        object = msg->mutable_transcript();
-        if (size > end - ptr + ::google::protobuf::internal::ParseContext::kSlopBytes) {
-          parser_till_end = ::google::protobuf::internal::GreedyStringParserUTF8;
-          goto string_till_end;
-        }
-        GOOGLE_PROTOBUF_PARSER_ASSERT(::google::protobuf::internal::StringCheckUTF8(ptr, size, ctx));
-        ::google::protobuf::internal::InlineGreedyStringParser(object, ptr, size, ctx);
-        ptr += size;
-        break;
-      }
-      // float confidence = 2;
-      case 2: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 21) goto handle_unusual;
-        msg->set_confidence(::google::protobuf::io::UnalignedLoad<float>(ptr));
-        ptr += sizeof(float);
-        break;
-      }
-      // float am_score = 3;
-      case 3: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 29) goto handle_unusual;
-        msg->set_am_score(::google::protobuf::io::UnalignedLoad<float>(ptr));
-        ptr += sizeof(float);
-        break;
-      }
-      // float lm_score = 4;
-      case 4: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 37) goto handle_unusual;
-        msg->set_lm_score(::google::protobuf::io::UnalignedLoad<float>(ptr));
-        ptr += sizeof(float);
-        break;
-      }
-      // repeated .kaldi_serve.Word words = 5;
-      case 5: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 42) goto handle_unusual;
-        do {
-          ptr = ::google::protobuf::io::ReadSize(ptr, &size);
-          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-          parser_till_end = ::kaldi_serve::Word::_InternalParse;
-          object = msg->add_words();
-          if (size > end - ptr) goto len_delim_till_end;
-          ptr += size;
-          GOOGLE_PROTOBUF_PARSER_ASSERT(ctx->ParseExactRange(
-              {parser_till_end, object}, ptr - size, ptr));
-          if (ptr >= end) break;
-        } while ((::google::protobuf::io::UnalignedLoad<::google::protobuf::uint64>(ptr) & 255) == 42 && (ptr += 1));
-        break;
-      }
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->EndGroup(tag);
-          return ptr;
-        }
-        auto res = UnknownFieldParse(tag, {_InternalParse, msg},
-          ptr, end, msg->_internal_metadata_.mutable_unknown_fields(), ctx);
-        ptr = res.first;
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
-        if (res.second) return ptr;
-      }
-    }  // switch
-  }  // while
-  return ptr;
-string_till_end:
-  static_cast<::std::string*>(object)->clear();
-  static_cast<::std::string*>(object)->reserve(size);
-  goto len_delim_till_end;
-len_delim_till_end:
-  return ctx->StoreAndTailCall(ptr, end, {_InternalParse, msg},
-                               {parser_till_end, object}, size);
-}
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool SpeechRecognitionAlternative::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:kaldi_serve.SpeechRecognitionAlternative)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string transcript = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_transcript()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->transcript().data(), static_cast<int>(this->transcript().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "kaldi_serve.SpeechRecognitionAlternative.transcript"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_transcript();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.SpeechRecognitionAlternative.transcript"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float confidence = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (21 & 0xFF)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &confidence_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.confidence_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float am_score = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (29 & 0xFF)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &am_score_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.am_score_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float lm_score = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (37 & 0xFF)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &lm_score_)));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _impl_.lm_score_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // repeated .kaldi_serve.Word words = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (42 & 0xFF)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-                input, add_words()));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_words(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:kaldi_serve.SpeechRecognitionAlternative)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:kaldi_serve.SpeechRecognitionAlternative)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-
-void SpeechRecognitionAlternative::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:kaldi_serve.SpeechRecognitionAlternative)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string transcript = 1;
-  if (this->transcript().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->transcript().data(), static_cast<int>(this->transcript().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "kaldi_serve.SpeechRecognitionAlternative.transcript");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->transcript(), output);
-  }
-
-  // float confidence = 2;
-  if (this->confidence() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->confidence(), output);
-  }
-
-  // float am_score = 3;
-  if (this->am_score() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->am_score(), output);
-  }
-
-  // float lm_score = 4;
-  if (this->lm_score() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(4, this->lm_score(), output);
-  }
-
-  // repeated .kaldi_serve.Word words = 5;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->words_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5,
-      this->words(static_cast<int>(i)),
-      output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:kaldi_serve.SpeechRecognitionAlternative)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* SpeechRecognitionAlternative::InternalSerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+uint8_t* SpeechRecognitionAlternative::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.SpeechRecognitionAlternative)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string transcript = 1;
-  if (this->transcript().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->transcript().data(), static_cast<int>(this->transcript().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_transcript().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_transcript().data(), static_cast<int>(this->_internal_transcript().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "kaldi_serve.SpeechRecognitionAlternative.transcript");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->transcript(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_transcript(), target);
   }
 
   // float confidence = 2;
-  if (this->confidence() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->confidence(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_confidence = this->_internal_confidence();
+  uint32_t raw_confidence;
+  memcpy(&raw_confidence, &tmp_confidence, sizeof(tmp_confidence));
+  if (raw_confidence != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_confidence(), target);
   }
 
   // float am_score = 3;
-  if (this->am_score() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->am_score(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_am_score = this->_internal_am_score();
+  uint32_t raw_am_score;
+  memcpy(&raw_am_score, &tmp_am_score, sizeof(tmp_am_score));
+  if (raw_am_score != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_am_score(), target);
   }
 
   // float lm_score = 4;
-  if (this->lm_score() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->lm_score(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_lm_score = this->_internal_lm_score();
+  uint32_t raw_lm_score;
+  memcpy(&raw_lm_score, &tmp_lm_score, sizeof(tmp_lm_score));
+  if (raw_lm_score != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_lm_score(), target);
   }
 
   // repeated .kaldi_serve.Word words = 5;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->words_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        5, this->words(static_cast<int>(i)), target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_words_size()); i < n; i++) {
+    const auto& repfield = this->_internal_words(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.SpeechRecognitionAlternative)
   return target;
@@ -2886,96 +2864,95 @@ size_t SpeechRecognitionAlternative::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:kaldi_serve.SpeechRecognitionAlternative)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .kaldi_serve.Word words = 5;
-  {
-    unsigned int count = static_cast<unsigned int>(this->words_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->words(static_cast<int>(i)));
-    }
+  total_size += 1UL * this->_internal_words_size();
+  for (const auto& msg : this->_impl_.words_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // string transcript = 1;
-  if (this->transcript().size() > 0) {
+  if (!this->_internal_transcript().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->transcript());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_transcript());
   }
 
   // float confidence = 2;
-  if (this->confidence() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_confidence = this->_internal_confidence();
+  uint32_t raw_confidence;
+  memcpy(&raw_confidence, &tmp_confidence, sizeof(tmp_confidence));
+  if (raw_confidence != 0) {
     total_size += 1 + 4;
   }
 
   // float am_score = 3;
-  if (this->am_score() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_am_score = this->_internal_am_score();
+  uint32_t raw_am_score;
+  memcpy(&raw_am_score, &tmp_am_score, sizeof(tmp_am_score));
+  if (raw_am_score != 0) {
     total_size += 1 + 4;
   }
 
   // float lm_score = 4;
-  if (this->lm_score() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_lm_score = this->_internal_lm_score();
+  uint32_t raw_lm_score;
+  memcpy(&raw_lm_score, &tmp_lm_score, sizeof(tmp_lm_score));
+  if (raw_lm_score != 0) {
     total_size += 1 + 4;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SpeechRecognitionAlternative::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:kaldi_serve.SpeechRecognitionAlternative)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SpeechRecognitionAlternative* source =
-      ::google::protobuf::DynamicCastToGenerated<SpeechRecognitionAlternative>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kaldi_serve.SpeechRecognitionAlternative)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:kaldi_serve.SpeechRecognitionAlternative)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SpeechRecognitionAlternative::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SpeechRecognitionAlternative::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SpeechRecognitionAlternative::GetClassData() const { return &_class_data_; }
 
-void SpeechRecognitionAlternative::MergeFrom(const SpeechRecognitionAlternative& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.SpeechRecognitionAlternative)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  words_.MergeFrom(from.words_);
-  if (from.transcript().size() > 0) {
+void SpeechRecognitionAlternative::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SpeechRecognitionAlternative*>(&to_msg);
+  auto& from = static_cast<const SpeechRecognitionAlternative&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.SpeechRecognitionAlternative)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    transcript_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.transcript_);
+  _this->_impl_.words_.MergeFrom(from._impl_.words_);
+  if (!from._internal_transcript().empty()) {
+    _this->_internal_set_transcript(from._internal_transcript());
   }
-  if (from.confidence() != 0) {
-    set_confidence(from.confidence());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_confidence = from._internal_confidence();
+  uint32_t raw_confidence;
+  memcpy(&raw_confidence, &tmp_confidence, sizeof(tmp_confidence));
+  if (raw_confidence != 0) {
+    _this->_internal_set_confidence(from._internal_confidence());
   }
-  if (from.am_score() != 0) {
-    set_am_score(from.am_score());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_am_score = from._internal_am_score();
+  uint32_t raw_am_score;
+  memcpy(&raw_am_score, &tmp_am_score, sizeof(tmp_am_score));
+  if (raw_am_score != 0) {
+    _this->_internal_set_am_score(from._internal_am_score());
   }
-  if (from.lm_score() != 0) {
-    set_lm_score(from.lm_score());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_lm_score = from._internal_lm_score();
+  uint32_t raw_lm_score;
+  memcpy(&raw_lm_score, &tmp_lm_score, sizeof(tmp_lm_score));
+  if (raw_lm_score != 0) {
+    _this->_internal_set_lm_score(from._internal_lm_score());
   }
-}
-
-void SpeechRecognitionAlternative::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:kaldi_serve.SpeechRecognitionAlternative)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SpeechRecognitionAlternative::CopyFrom(const SpeechRecognitionAlternative& from) {
@@ -2989,333 +2966,227 @@ bool SpeechRecognitionAlternative::IsInitialized() const {
   return true;
 }
 
-void SpeechRecognitionAlternative::Swap(SpeechRecognitionAlternative* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void SpeechRecognitionAlternative::InternalSwap(SpeechRecognitionAlternative* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  CastToBase(&words_)->InternalSwap(CastToBase(&other->words_));
-  transcript_.Swap(&other->transcript_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(confidence_, other->confidence_);
-  swap(am_score_, other->am_score_);
-  swap(lm_score_, other->lm_score_);
-}
-
-::google::protobuf::Metadata SpeechRecognitionAlternative::GetMetadata() const {
-  ::google::protobuf::internal::AssignDescriptors(&::assign_descriptors_table_kaldi_5fserve_2eproto);
-  return ::file_level_metadata_kaldi_5fserve_2eproto[kIndexInFileMessages];
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.words_.InternalSwap(&other->_impl_.words_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.transcript_, lhs_arena,
+      &other->_impl_.transcript_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SpeechRecognitionAlternative, _impl_.lm_score_)
+      + sizeof(SpeechRecognitionAlternative::_impl_.lm_score_)
+      - PROTOBUF_FIELD_OFFSET(SpeechRecognitionAlternative, _impl_.confidence_)>(
+          reinterpret_cast<char*>(&_impl_.confidence_),
+          reinterpret_cast<char*>(&other->_impl_.confidence_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SpeechRecognitionAlternative::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[9]);
 }
 
-
 // ===================================================================
 
-void Word::InitAsDefaultInstance() {
-}
-class Word::HasBitSetters {
+class Word::_Internal {
  public:
 };
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Word::kStartTimeFieldNumber;
-const int Word::kEndTimeFieldNumber;
-const int Word::kWordFieldNumber;
-const int Word::kConfidenceFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-Word::Word()
-  : ::google::protobuf::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:kaldi_serve.Word)
+Word::Word(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.Word)
 }
 Word::Word(const Word& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  word_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.word().size() > 0) {
-    word_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.word_);
-  }
-  ::memcpy(&start_time_, &from.start_time_,
-    static_cast<size_t>(reinterpret_cast<char*>(&confidence_) -
-    reinterpret_cast<char*>(&start_time_)) + sizeof(confidence_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Word* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.word_){}
+    , decltype(_impl_.start_time_){}
+    , decltype(_impl_.end_time_){}
+    , decltype(_impl_.confidence_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.word_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.word_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_word().empty()) {
+    _this->_impl_.word_.Set(from._internal_word(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.start_time_, &from._impl_.start_time_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.confidence_) -
+    reinterpret_cast<char*>(&_impl_.start_time_)) + sizeof(_impl_.confidence_));
   // @@protoc_insertion_point(copy_constructor:kaldi_serve.Word)
 }
 
-void Word::SharedCtor() {
-  ::google::protobuf::internal::InitSCC(
-      &scc_info_Word_kaldi_5fserve_2eproto.base);
-  word_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&start_time_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&confidence_) -
-      reinterpret_cast<char*>(&start_time_)) + sizeof(confidence_));
+inline void Word::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.word_){}
+    , decltype(_impl_.start_time_){0}
+    , decltype(_impl_.end_time_){0}
+    , decltype(_impl_.confidence_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.word_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.word_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Word::~Word() {
   // @@protoc_insertion_point(destructor:kaldi_serve.Word)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Word::SharedDtor() {
-  word_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Word::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.word_.Destroy();
 }
 
 void Word::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const Word& Word::default_instance() {
-  ::google::protobuf::internal::InitSCC(&::scc_info_Word_kaldi_5fserve_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void Word::Clear() {
 // @@protoc_insertion_point(message_clear_start:kaldi_serve.Word)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  word_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&start_time_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&confidence_) -
-      reinterpret_cast<char*>(&start_time_)) + sizeof(confidence_));
-  _internal_metadata_.Clear();
-}
-
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* Word::_InternalParse(const char* begin, const char* end, void* object,
-                  ::google::protobuf::internal::ParseContext* ctx) {
-  auto msg = static_cast<Word*>(object);
-  ::google::protobuf::int32 size; (void)size;
-  int depth; (void)depth;
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::ParseFunc parser_till_end; (void)parser_till_end;
-  auto ptr = begin;
-  while (ptr < end) {
-    ptr = ::google::protobuf::io::Parse32(ptr, &tag);
-    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+  _impl_.word_.ClearToEmpty();
+  ::memset(&_impl_.start_time_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.confidence_) -
+      reinterpret_cast<char*>(&_impl_.start_time_)) + sizeof(_impl_.confidence_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Word::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // float start_time = 1;
-      case 1: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 13) goto handle_unusual;
-        msg->set_start_time(::google::protobuf::io::UnalignedLoad<float>(ptr));
-        ptr += sizeof(float);
-        break;
-      }
-      // float end_time = 2;
-      case 2: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 21) goto handle_unusual;
-        msg->set_end_time(::google::protobuf::io::UnalignedLoad<float>(ptr));
-        ptr += sizeof(float);
-        break;
-      }
-      // string word = 3;
-      case 3: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 26) goto handle_unusual;
-        ptr = ::google::protobuf::io::ReadSize(ptr, &size);
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-        ctx->extra_parse_data().SetFieldName("kaldi_serve.Word.word");
-        object = msg->mutable_word();
-        if (size > end - ptr + ::google::protobuf::internal::ParseContext::kSlopBytes) {
-          parser_till_end = ::google::protobuf::internal::GreedyStringParserUTF8;
-          goto string_till_end;
-        }
-        GOOGLE_PROTOBUF_PARSER_ASSERT(::google::protobuf::internal::StringCheckUTF8(ptr, size, ctx));
-        ::google::protobuf::internal::InlineGreedyStringParser(object, ptr, size, ctx);
-        ptr += size;
-        break;
-      }
-      // float confidence = 4;
-      case 4: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 37) goto handle_unusual;
-        msg->set_confidence(::google::protobuf::io::UnalignedLoad<float>(ptr));
-        ptr += sizeof(float);
-        break;
-      }
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->EndGroup(tag);
-          return ptr;
-        }
-        auto res = UnknownFieldParse(tag, {_InternalParse, msg},
-          ptr, end, msg->_internal_metadata_.mutable_unknown_fields(), ctx);
-        ptr = res.first;
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
-        if (res.second) return ptr;
-      }
-    }  // switch
-  }  // while
-  return ptr;
-string_till_end:
-  static_cast<::std::string*>(object)->clear();
-  static_cast<::std::string*>(object)->reserve(size);
-  goto len_delim_till_end;
-len_delim_till_end:
-  return ctx->StoreAndTailCall(ptr, end, {_InternalParse, msg},
-                               {parser_till_end, object}, size);
-}
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool Word::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:kaldi_serve.Word)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // float start_time = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (13 & 0xFF)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &start_time_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.start_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float end_time = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (21 & 0xFF)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &end_time_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.end_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string word = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (26 & 0xFF)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_word()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->word().data(), static_cast<int>(this->word().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "kaldi_serve.Word.word"));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_word();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.Word.word"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float confidence = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (37 & 0xFF)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &confidence_)));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _impl_.confidence_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:kaldi_serve.Word)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:kaldi_serve.Word)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-
-void Word::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:kaldi_serve.Word)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // float start_time = 1;
-  if (this->start_time() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->start_time(), output);
-  }
-
-  // float end_time = 2;
-  if (this->end_time() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->end_time(), output);
-  }
-
-  // string word = 3;
-  if (this->word().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->word().data(), static_cast<int>(this->word().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "kaldi_serve.Word.word");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->word(), output);
-  }
-
-  // float confidence = 4;
-  if (this->confidence() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(4, this->confidence(), output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:kaldi_serve.Word)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* Word::InternalSerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+uint8_t* Word::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.Word)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // float start_time = 1;
-  if (this->start_time() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->start_time(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_start_time = this->_internal_start_time();
+  uint32_t raw_start_time;
+  memcpy(&raw_start_time, &tmp_start_time, sizeof(tmp_start_time));
+  if (raw_start_time != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_start_time(), target);
   }
 
   // float end_time = 2;
-  if (this->end_time() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->end_time(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_end_time = this->_internal_end_time();
+  uint32_t raw_end_time;
+  memcpy(&raw_end_time, &tmp_end_time, sizeof(tmp_end_time));
+  if (raw_end_time != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_end_time(), target);
   }
 
   // string word = 3;
-  if (this->word().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->word().data(), static_cast<int>(this->word().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_word().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_word().data(), static_cast<int>(this->_internal_word().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "kaldi_serve.Word.word");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->word(), target);
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_word(), target);
   }
 
   // float confidence = 4;
-  if (this->confidence() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->confidence(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_confidence = this->_internal_confidence();
+  uint32_t raw_confidence;
+  memcpy(&raw_confidence, &tmp_confidence, sizeof(tmp_confidence));
+  if (raw_confidence != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_confidence(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.Word)
   return target;
@@ -3325,84 +3196,87 @@ size_t Word::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:kaldi_serve.Word)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string word = 3;
-  if (this->word().size() > 0) {
+  if (!this->_internal_word().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->word());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_word());
   }
 
   // float start_time = 1;
-  if (this->start_time() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_start_time = this->_internal_start_time();
+  uint32_t raw_start_time;
+  memcpy(&raw_start_time, &tmp_start_time, sizeof(tmp_start_time));
+  if (raw_start_time != 0) {
     total_size += 1 + 4;
   }
 
   // float end_time = 2;
-  if (this->end_time() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_end_time = this->_internal_end_time();
+  uint32_t raw_end_time;
+  memcpy(&raw_end_time, &tmp_end_time, sizeof(tmp_end_time));
+  if (raw_end_time != 0) {
     total_size += 1 + 4;
   }
 
   // float confidence = 4;
-  if (this->confidence() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_confidence = this->_internal_confidence();
+  uint32_t raw_confidence;
+  memcpy(&raw_confidence, &tmp_confidence, sizeof(tmp_confidence));
+  if (raw_confidence != 0) {
     total_size += 1 + 4;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Word::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:kaldi_serve.Word)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Word* source =
-      ::google::protobuf::DynamicCastToGenerated<Word>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kaldi_serve.Word)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:kaldi_serve.Word)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Word::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Word::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Word::GetClassData() const { return &_class_data_; }
 
-void Word::MergeFrom(const Word& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.Word)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.word().size() > 0) {
+void Word::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Word*>(&to_msg);
+  auto& from = static_cast<const Word&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.Word)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    word_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.word_);
+  if (!from._internal_word().empty()) {
+    _this->_internal_set_word(from._internal_word());
   }
-  if (from.start_time() != 0) {
-    set_start_time(from.start_time());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_start_time = from._internal_start_time();
+  uint32_t raw_start_time;
+  memcpy(&raw_start_time, &tmp_start_time, sizeof(tmp_start_time));
+  if (raw_start_time != 0) {
+    _this->_internal_set_start_time(from._internal_start_time());
   }
-  if (from.end_time() != 0) {
-    set_end_time(from.end_time());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_end_time = from._internal_end_time();
+  uint32_t raw_end_time;
+  memcpy(&raw_end_time, &tmp_end_time, sizeof(tmp_end_time));
+  if (raw_end_time != 0) {
+    _this->_internal_set_end_time(from._internal_end_time());
   }
-  if (from.confidence() != 0) {
-    set_confidence(from.confidence());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_confidence = from._internal_confidence();
+  uint32_t raw_confidence;
+  memcpy(&raw_confidence, &tmp_confidence, sizeof(tmp_confidence));
+  if (raw_confidence != 0) {
+    _this->_internal_set_confidence(from._internal_confidence());
   }
-}
-
-void Word::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:kaldi_serve.Word)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Word::CopyFrom(const Word& from) {
@@ -3416,288 +3290,189 @@ bool Word::IsInitialized() const {
   return true;
 }
 
-void Word::Swap(Word* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Word::InternalSwap(Word* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  word_.Swap(&other->word_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(start_time_, other->start_time_);
-  swap(end_time_, other->end_time_);
-  swap(confidence_, other->confidence_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.word_, lhs_arena,
+      &other->_impl_.word_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Word, _impl_.confidence_)
+      + sizeof(Word::_impl_.confidence_)
+      - PROTOBUF_FIELD_OFFSET(Word, _impl_.start_time_)>(
+          reinterpret_cast<char*>(&_impl_.start_time_),
+          reinterpret_cast<char*>(&other->_impl_.start_time_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Word::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[10]);
 }
 
-::google::protobuf::Metadata Word::GetMetadata() const {
-  ::google::protobuf::internal::AssignDescriptors(&::assign_descriptors_table_kaldi_5fserve_2eproto);
-  return ::file_level_metadata_kaldi_5fserve_2eproto[kIndexInFileMessages];
-}
-
-
 // ===================================================================
 
-void SpeechContext::InitAsDefaultInstance() {
-}
-class SpeechContext::HasBitSetters {
+class SpeechContext::_Internal {
  public:
 };
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SpeechContext::kPhrasesFieldNumber;
-const int SpeechContext::kTypeFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-SpeechContext::SpeechContext()
-  : ::google::protobuf::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:kaldi_serve.SpeechContext)
+SpeechContext::SpeechContext(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.SpeechContext)
 }
 SpeechContext::SpeechContext(const SpeechContext& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(nullptr),
-      phrases_(from.phrases_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  type_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.type().size() > 0) {
-    type_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.type_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SpeechContext* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.phrases_){from._impl_.phrases_}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_type().empty()) {
+    _this->_impl_.type_.Set(from._internal_type(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:kaldi_serve.SpeechContext)
 }
 
-void SpeechContext::SharedCtor() {
-  ::google::protobuf::internal::InitSCC(
-      &scc_info_SpeechContext_kaldi_5fserve_2eproto.base);
-  type_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void SpeechContext::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.phrases_){arena}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 SpeechContext::~SpeechContext() {
   // @@protoc_insertion_point(destructor:kaldi_serve.SpeechContext)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SpeechContext::SharedDtor() {
-  type_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void SpeechContext::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.phrases_.~RepeatedPtrField();
+  _impl_.type_.Destroy();
 }
 
 void SpeechContext::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const SpeechContext& SpeechContext::default_instance() {
-  ::google::protobuf::internal::InitSCC(&::scc_info_SpeechContext_kaldi_5fserve_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void SpeechContext::Clear() {
 // @@protoc_insertion_point(message_clear_start:kaldi_serve.SpeechContext)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  phrases_.Clear();
-  type_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
-}
-
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* SpeechContext::_InternalParse(const char* begin, const char* end, void* object,
-                  ::google::protobuf::internal::ParseContext* ctx) {
-  auto msg = static_cast<SpeechContext*>(object);
-  ::google::protobuf::int32 size; (void)size;
-  int depth; (void)depth;
-  ::google::protobuf::uint32 tag;
-  ::google::protobuf::internal::ParseFunc parser_till_end; (void)parser_till_end;
-  auto ptr = begin;
-  while (ptr < end) {
-    ptr = ::google::protobuf::io::Parse32(ptr, &tag);
-    GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
+  _impl_.phrases_.Clear();
+  _impl_.type_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SpeechContext::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated string phrases = 1;
-      case 1: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 10) goto handle_unusual;
-        do {
-          ptr = ::google::protobuf::io::ReadSize(ptr, &size);
-          GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-          ctx->extra_parse_data().SetFieldName("kaldi_serve.SpeechContext.phrases");
-          object = msg->add_phrases();
-          if (size > end - ptr + ::google::protobuf::internal::ParseContext::kSlopBytes) {
-            parser_till_end = ::google::protobuf::internal::GreedyStringParserUTF8;
-            goto string_till_end;
-          }
-          GOOGLE_PROTOBUF_PARSER_ASSERT(::google::protobuf::internal::StringCheckUTF8(ptr, size, ctx));
-          ::google::protobuf::internal::InlineGreedyStringParser(object, ptr, size, ctx);
-          ptr += size;
-          if (ptr >= end) break;
-        } while ((::google::protobuf::io::UnalignedLoad<::google::protobuf::uint64>(ptr) & 255) == 10 && (ptr += 1));
-        break;
-      }
-      // string type = 2;
-      case 2: {
-        if (static_cast<::google::protobuf::uint8>(tag) != 18) goto handle_unusual;
-        ptr = ::google::protobuf::io::ReadSize(ptr, &size);
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr);
-        ctx->extra_parse_data().SetFieldName("kaldi_serve.SpeechContext.type");
-        object = msg->mutable_type();
-        if (size > end - ptr + ::google::protobuf::internal::ParseContext::kSlopBytes) {
-          parser_till_end = ::google::protobuf::internal::GreedyStringParserUTF8;
-          goto string_till_end;
-        }
-        GOOGLE_PROTOBUF_PARSER_ASSERT(::google::protobuf::internal::StringCheckUTF8(ptr, size, ctx));
-        ::google::protobuf::internal::InlineGreedyStringParser(object, ptr, size, ctx);
-        ptr += size;
-        break;
-      }
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->EndGroup(tag);
-          return ptr;
-        }
-        auto res = UnknownFieldParse(tag, {_InternalParse, msg},
-          ptr, end, msg->_internal_metadata_.mutable_unknown_fields(), ctx);
-        ptr = res.first;
-        GOOGLE_PROTOBUF_PARSER_ASSERT(ptr != nullptr);
-        if (res.second) return ptr;
-      }
-    }  // switch
-  }  // while
-  return ptr;
-string_till_end:
-  static_cast<::std::string*>(object)->clear();
-  static_cast<::std::string*>(object)->reserve(size);
-  goto len_delim_till_end;
-len_delim_till_end:
-  return ctx->StoreAndTailCall(ptr, end, {_InternalParse, msg},
-                               {parser_till_end, object}, size);
-}
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool SpeechContext::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:kaldi_serve.SpeechContext)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated string phrases = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_phrases()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->phrases(this->phrases_size() - 1).data(),
-            static_cast<int>(this->phrases(this->phrases_size() - 1).length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "kaldi_serve.SpeechContext.phrases"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_phrases();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.SpeechContext.phrases"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string type = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) == (18 & 0xFF)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_type()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->type().data(), static_cast<int>(this->type().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "kaldi_serve.SpeechContext.type"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.SpeechContext.type"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:kaldi_serve.SpeechContext)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:kaldi_serve.SpeechContext)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-
-void SpeechContext::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:kaldi_serve.SpeechContext)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // repeated string phrases = 1;
-  for (int i = 0, n = this->phrases_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->phrases(i).data(), static_cast<int>(this->phrases(i).length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "kaldi_serve.SpeechContext.phrases");
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->phrases(i), output);
-  }
-
-  // string type = 2;
-  if (this->type().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->type().data(), static_cast<int>(this->type().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "kaldi_serve.SpeechContext.type");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->type(), output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:kaldi_serve.SpeechContext)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* SpeechContext::InternalSerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+uint8_t* SpeechContext::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.SpeechContext)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated string phrases = 1;
-  for (int i = 0, n = this->phrases_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->phrases(i).data(), static_cast<int>(this->phrases(i).length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  for (int i = 0, n = this->_internal_phrases_size(); i < n; i++) {
+    const auto& s = this->_internal_phrases(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "kaldi_serve.SpeechContext.phrases");
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(1, this->phrases(i), target);
+    target = stream->WriteString(1, s, target);
   }
 
   // string type = 2;
-  if (this->type().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->type().data(), static_cast<int>(this->type().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_type().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_type().data(), static_cast<int>(this->_internal_type().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "kaldi_serve.SpeechContext.type");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->type(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_type(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.SpeechContext)
   return target;
@@ -3707,69 +3482,48 @@ size_t SpeechContext::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:kaldi_serve.SpeechContext)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated string phrases = 1;
   total_size += 1 *
-      ::google::protobuf::internal::FromIntSize(this->phrases_size());
-  for (int i = 0, n = this->phrases_size(); i < n; i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-      this->phrases(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.phrases_.size());
+  for (int i = 0, n = _impl_.phrases_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.phrases_.Get(i));
   }
 
   // string type = 2;
-  if (this->type().size() > 0) {
+  if (!this->_internal_type().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->type());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_type());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SpeechContext::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:kaldi_serve.SpeechContext)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SpeechContext* source =
-      ::google::protobuf::DynamicCastToGenerated<SpeechContext>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kaldi_serve.SpeechContext)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:kaldi_serve.SpeechContext)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SpeechContext::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SpeechContext::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SpeechContext::GetClassData() const { return &_class_data_; }
 
-void SpeechContext::MergeFrom(const SpeechContext& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.SpeechContext)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  phrases_.MergeFrom(from.phrases_);
-  if (from.type().size() > 0) {
+void SpeechContext::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SpeechContext*>(&to_msg);
+  auto& from = static_cast<const SpeechContext&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.SpeechContext)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    type_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.type_);
+  _this->_impl_.phrases_.MergeFrom(from._impl_.phrases_);
+  if (!from._internal_type().empty()) {
+    _this->_internal_set_type(from._internal_type());
   }
-}
-
-void SpeechContext::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:kaldi_serve.SpeechContext)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SpeechContext::CopyFrom(const SpeechContext& from) {
@@ -3783,54 +3537,76 @@ bool SpeechContext::IsInitialized() const {
   return true;
 }
 
-void SpeechContext::Swap(SpeechContext* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void SpeechContext::InternalSwap(SpeechContext* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  phrases_.InternalSwap(CastToBase(&other->phrases_));
-  type_.Swap(&other->type_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.phrases_.InternalSwap(&other->_impl_.phrases_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.type_, lhs_arena,
+      &other->_impl_.type_, rhs_arena
+  );
 }
 
-::google::protobuf::Metadata SpeechContext::GetMetadata() const {
-  ::google::protobuf::internal::AssignDescriptors(&::assign_descriptors_table_kaldi_5fserve_2eproto);
-  return ::file_level_metadata_kaldi_5fserve_2eproto[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata SpeechContext::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[11]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace kaldi_serve
-namespace google {
-namespace protobuf {
-template<> PROTOBUF_NOINLINE ::kaldi_serve::RecognizeRequest* Arena::CreateMaybeMessage< ::kaldi_serve::RecognizeRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::kaldi_serve::RecognizeRequest >(arena);
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::kaldi_serve::RecognizeRequest*
+Arena::CreateMaybeMessage< ::kaldi_serve::RecognizeRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::RecognizeRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kaldi_serve::RecognizeResponse*
+Arena::CreateMaybeMessage< ::kaldi_serve::RecognizeResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::RecognizeResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kaldi_serve::SearchParams*
+Arena::CreateMaybeMessage< ::kaldi_serve::SearchParams >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::SearchParams >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kaldi_serve::MetricsRequest*
+Arena::CreateMaybeMessage< ::kaldi_serve::MetricsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::MetricsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kaldi_serve::MetricsResponse_MetricsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::kaldi_serve::MetricsResponse_MetricsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::MetricsResponse_MetricsEntry_DoNotUse >(arena);
 }
-template<> PROTOBUF_NOINLINE ::kaldi_serve::RecognizeResponse* Arena::CreateMaybeMessage< ::kaldi_serve::RecognizeResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::kaldi_serve::RecognizeResponse >(arena);
+template<> PROTOBUF_NOINLINE ::kaldi_serve::MetricsResponse*
+Arena::CreateMaybeMessage< ::kaldi_serve::MetricsResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::MetricsResponse >(arena);
 }
-template<> PROTOBUF_NOINLINE ::kaldi_serve::RecognitionConfig* Arena::CreateMaybeMessage< ::kaldi_serve::RecognitionConfig >(Arena* arena) {
-  return Arena::CreateInternal< ::kaldi_serve::RecognitionConfig >(arena);
+template<> PROTOBUF_NOINLINE ::kaldi_serve::RecognitionConfig*
+Arena::CreateMaybeMessage< ::kaldi_serve::RecognitionConfig >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::RecognitionConfig >(arena);
 }
-template<> PROTOBUF_NOINLINE ::kaldi_serve::RecognitionAudio* Arena::CreateMaybeMessage< ::kaldi_serve::RecognitionAudio >(Arena* arena) {
-  return Arena::CreateInternal< ::kaldi_serve::RecognitionAudio >(arena);
+template<> PROTOBUF_NOINLINE ::kaldi_serve::RecognitionAudio*
+Arena::CreateMaybeMessage< ::kaldi_serve::RecognitionAudio >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::RecognitionAudio >(arena);
 }
-template<> PROTOBUF_NOINLINE ::kaldi_serve::SpeechRecognitionResult* Arena::CreateMaybeMessage< ::kaldi_serve::SpeechRecognitionResult >(Arena* arena) {
-  return Arena::CreateInternal< ::kaldi_serve::SpeechRecognitionResult >(arena);
+template<> PROTOBUF_NOINLINE ::kaldi_serve::SpeechRecognitionResult*
+Arena::CreateMaybeMessage< ::kaldi_serve::SpeechRecognitionResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::SpeechRecognitionResult >(arena);
 }
-template<> PROTOBUF_NOINLINE ::kaldi_serve::SpeechRecognitionAlternative* Arena::CreateMaybeMessage< ::kaldi_serve::SpeechRecognitionAlternative >(Arena* arena) {
-  return Arena::CreateInternal< ::kaldi_serve::SpeechRecognitionAlternative >(arena);
+template<> PROTOBUF_NOINLINE ::kaldi_serve::SpeechRecognitionAlternative*
+Arena::CreateMaybeMessage< ::kaldi_serve::SpeechRecognitionAlternative >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::SpeechRecognitionAlternative >(arena);
 }
-template<> PROTOBUF_NOINLINE ::kaldi_serve::Word* Arena::CreateMaybeMessage< ::kaldi_serve::Word >(Arena* arena) {
-  return Arena::CreateInternal< ::kaldi_serve::Word >(arena);
+template<> PROTOBUF_NOINLINE ::kaldi_serve::Word*
+Arena::CreateMaybeMessage< ::kaldi_serve::Word >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::Word >(arena);
 }
-template<> PROTOBUF_NOINLINE ::kaldi_serve::SpeechContext* Arena::CreateMaybeMessage< ::kaldi_serve::SpeechContext >(Arena* arena) {
-  return Arena::CreateInternal< ::kaldi_serve::SpeechContext >(arena);
+template<> PROTOBUF_NOINLINE ::kaldi_serve::SpeechContext*
+Arena::CreateMaybeMessage< ::kaldi_serve::SpeechContext >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::SpeechContext >(arena);
 }
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 #include <google/protobuf/port_undef.inc>
@@ -1,19 +1,19 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: kaldi_serve.proto
 
-#ifndef PROTOBUF_INCLUDED_kaldi_5fserve_2eproto
-#define PROTOBUF_INCLUDED_kaldi_5fserve_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_kaldi_5fserve_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_kaldi_5fserve_2eproto
 
 #include <limits>
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3007000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3007000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,129 +23,157 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_bases.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry.h>
+#include <google/protobuf/map_field_inl.h>
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
 #define PROTOBUF_INTERNAL_EXPORT_kaldi_5fserve_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_kaldi_5fserve_2eproto {
-  static const ::google::protobuf::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::google::protobuf::internal::ParseTable schema[8]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+  static const uint32_t offsets[];
 };
-void AddDescriptors_kaldi_5fserve_2eproto();
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_kaldi_5fserve_2eproto;
 namespace kaldi_serve {
+class MetricsRequest;
+struct MetricsRequestDefaultTypeInternal;
+extern MetricsRequestDefaultTypeInternal _MetricsRequest_default_instance_;
+class MetricsResponse;
+struct MetricsResponseDefaultTypeInternal;
+extern MetricsResponseDefaultTypeInternal _MetricsResponse_default_instance_;
+class MetricsResponse_MetricsEntry_DoNotUse;
+struct MetricsResponse_MetricsEntry_DoNotUseDefaultTypeInternal;
+extern MetricsResponse_MetricsEntry_DoNotUseDefaultTypeInternal _MetricsResponse_MetricsEntry_DoNotUse_default_instance_;
 class RecognitionAudio;
-class RecognitionAudioDefaultTypeInternal;
+struct RecognitionAudioDefaultTypeInternal;
 extern RecognitionAudioDefaultTypeInternal _RecognitionAudio_default_instance_;
 class RecognitionConfig;
-class RecognitionConfigDefaultTypeInternal;
+struct RecognitionConfigDefaultTypeInternal;
 extern RecognitionConfigDefaultTypeInternal _RecognitionConfig_default_instance_;
 class RecognizeRequest;
-class RecognizeRequestDefaultTypeInternal;
+struct RecognizeRequestDefaultTypeInternal;
 extern RecognizeRequestDefaultTypeInternal _RecognizeRequest_default_instance_;
 class RecognizeResponse;
-class RecognizeResponseDefaultTypeInternal;
+struct RecognizeResponseDefaultTypeInternal;
 extern RecognizeResponseDefaultTypeInternal _RecognizeResponse_default_instance_;
+class SearchParams;
+struct SearchParamsDefaultTypeInternal;
+extern SearchParamsDefaultTypeInternal _SearchParams_default_instance_;
 class SpeechContext;
-class SpeechContextDefaultTypeInternal;
+struct SpeechContextDefaultTypeInternal;
 extern SpeechContextDefaultTypeInternal _SpeechContext_default_instance_;
 class SpeechRecognitionAlternative;
-class SpeechRecognitionAlternativeDefaultTypeInternal;
+struct SpeechRecognitionAlternativeDefaultTypeInternal;
 extern SpeechRecognitionAlternativeDefaultTypeInternal _SpeechRecognitionAlternative_default_instance_;
 class SpeechRecognitionResult;
-class SpeechRecognitionResultDefaultTypeInternal;
+struct SpeechRecognitionResultDefaultTypeInternal;
 extern SpeechRecognitionResultDefaultTypeInternal _SpeechRecognitionResult_default_instance_;
 class Word;
-class WordDefaultTypeInternal;
+struct WordDefaultTypeInternal;
 extern WordDefaultTypeInternal _Word_default_instance_;
 }  // namespace kaldi_serve
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
+template<> ::kaldi_serve::MetricsRequest* Arena::CreateMaybeMessage<::kaldi_serve::MetricsRequest>(Arena*);
+template<> ::kaldi_serve::MetricsResponse* Arena::CreateMaybeMessage<::kaldi_serve::MetricsResponse>(Arena*);
+template<> ::kaldi_serve::MetricsResponse_MetricsEntry_DoNotUse* Arena::CreateMaybeMessage<::kaldi_serve::MetricsResponse_MetricsEntry_DoNotUse>(Arena*);
 template<> ::kaldi_serve::RecognitionAudio* Arena::CreateMaybeMessage<::kaldi_serve::RecognitionAudio>(Arena*);
 template<> ::kaldi_serve::RecognitionConfig* Arena::CreateMaybeMessage<::kaldi_serve::RecognitionConfig>(Arena*);
 template<> ::kaldi_serve::RecognizeRequest* Arena::CreateMaybeMessage<::kaldi_serve::RecognizeRequest>(Arena*);
 template<> ::kaldi_serve::RecognizeResponse* Arena::CreateMaybeMessage<::kaldi_serve::RecognizeResponse>(Arena*);
+template<> ::kaldi_serve::SearchParams* Arena::CreateMaybeMessage<::kaldi_serve::SearchParams>(Arena*);
 template<> ::kaldi_serve::SpeechContext* Arena::CreateMaybeMessage<::kaldi_serve::SpeechContext>(Arena*);
 template<> ::kaldi_serve::SpeechRecognitionAlternative* Arena::CreateMaybeMessage<::kaldi_serve::SpeechRecognitionAlternative>(Arena*);
 template<> ::kaldi_serve::SpeechRecognitionResult* Arena::CreateMaybeMessage<::kaldi_serve::SpeechRecognitionResult>(Arena*);
 template<> ::kaldi_serve::Word* Arena::CreateMaybeMessage<::kaldi_serve::Word>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 namespace kaldi_serve {
 
-enum RecognitionConfig_AudioEncoding {
+enum RecognitionConfig_AudioEncoding : int {
   RecognitionConfig_AudioEncoding_ENCODING_UNSPECIFIED = 0,
   RecognitionConfig_AudioEncoding_LINEAR16 = 1,
   RecognitionConfig_AudioEncoding_FLAC = 2,
-  RecognitionConfig_AudioEncoding_RecognitionConfig_AudioEncoding_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::google::protobuf::int32>::min(),
-  RecognitionConfig_AudioEncoding_RecognitionConfig_AudioEncoding_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::google::protobuf::int32>::max()
+  RecognitionConfig_AudioEncoding_RecognitionConfig_AudioEncoding_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  RecognitionConfig_AudioEncoding_RecognitionConfig_AudioEncoding_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool RecognitionConfig_AudioEncoding_IsValid(int value);
-const RecognitionConfig_AudioEncoding RecognitionConfig_AudioEncoding_AudioEncoding_MIN = RecognitionConfig_AudioEncoding_ENCODING_UNSPECIFIED;
-const RecognitionConfig_AudioEncoding RecognitionConfig_AudioEncoding_AudioEncoding_MAX = RecognitionConfig_AudioEncoding_FLAC;
-const int RecognitionConfig_AudioEncoding_AudioEncoding_ARRAYSIZE = RecognitionConfig_AudioEncoding_AudioEncoding_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* RecognitionConfig_AudioEncoding_descriptor();
-inline const ::std::string& RecognitionConfig_AudioEncoding_Name(RecognitionConfig_AudioEncoding value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    RecognitionConfig_AudioEncoding_descriptor(), value);
+constexpr RecognitionConfig_AudioEncoding RecognitionConfig_AudioEncoding_AudioEncoding_MIN = RecognitionConfig_AudioEncoding_ENCODING_UNSPECIFIED;
+constexpr RecognitionConfig_AudioEncoding RecognitionConfig_AudioEncoding_AudioEncoding_MAX = RecognitionConfig_AudioEncoding_FLAC;
+constexpr int RecognitionConfig_AudioEncoding_AudioEncoding_ARRAYSIZE = RecognitionConfig_AudioEncoding_AudioEncoding_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RecognitionConfig_AudioEncoding_descriptor();
+template<typename T>
+inline const std::string& RecognitionConfig_AudioEncoding_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RecognitionConfig_AudioEncoding>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RecognitionConfig_AudioEncoding_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RecognitionConfig_AudioEncoding_descriptor(), enum_t_value);
 }
 inline bool RecognitionConfig_AudioEncoding_Parse(
-    const ::std::string& name, RecognitionConfig_AudioEncoding* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<RecognitionConfig_AudioEncoding>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RecognitionConfig_AudioEncoding* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RecognitionConfig_AudioEncoding>(
     RecognitionConfig_AudioEncoding_descriptor(), name, value);
 }
 // ===================================================================
 
 class RecognizeRequest final :
-    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.RecognizeRequest) */ {
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.RecognizeRequest) */ {
  public:
-  RecognizeRequest();
-  virtual ~RecognizeRequest();
+  inline RecognizeRequest() : RecognizeRequest(nullptr) {}
+  ~RecognizeRequest() override;
+  explicit PROTOBUF_CONSTEXPR RecognizeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RecognizeRequest(const RecognizeRequest& from);
-
-  inline RecognizeRequest& operator=(const RecognizeRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   RecognizeRequest(RecognizeRequest&& from) noexcept
     : RecognizeRequest() {
     *this = ::std::move(from);
   }
 
+  inline RecognizeRequest& operator=(const RecognizeRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline RecognizeRequest& operator=(RecognizeRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return default_instance().GetDescriptor();
-  }
-  static const RecognizeRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RecognizeRequest& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const RecognizeRequest* internal_default_instance() {
     return reinterpret_cast<const RecognizeRequest*>(
                &_RecognizeRequest_default_instance_);
@@ -153,139 +181,192 @@ class RecognizeRequest final :
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(RecognizeRequest* other);
   friend void swap(RecognizeRequest& a, RecognizeRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(RecognizeRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RecognizeRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RecognizeRequest* New() const final {
-    return CreateMaybeMessage<RecognizeRequest>(nullptr);
-  }
-
-  RecognizeRequest* New(::google::protobuf::Arena* arena) const final {
+  RecognizeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RecognizeRequest>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RecognizeRequest& from);
-  void MergeFrom(const RecognizeRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RecognizeRequest& from) {
+    RecognizeRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  static const char* _InternalParse(const char* begin, const char* end, void* object, ::google::protobuf::internal::ParseContext* ctx);
-  ::google::protobuf::internal::ParseFunc _ParseFunc() const final { return _InternalParse; }
-  #else
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RecognizeRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kaldi_serve.RecognizeRequest";
   }
+  protected:
+  explicit RecognizeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kUuidFieldNumber = 3,
+    kConfigFieldNumber = 1,
+    kAudioFieldNumber = 2,
+  };
   // string uuid = 3;
   void clear_uuid();
-  static const int kUuidFieldNumber = 3;
-  const ::std::string& uuid() const;
-  void set_uuid(const ::std::string& value);
-  #if LANG_CXX11
-  void set_uuid(::std::string&& value);
-  #endif
-  void set_uuid(const char* value);
-  void set_uuid(const char* value, size_t size);
-  ::std::string* mutable_uuid();
-  ::std::string* release_uuid();
-  void set_allocated_uuid(::std::string* uuid);
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
 
   // .kaldi_serve.RecognitionConfig config = 1;
   bool has_config() const;
+  private:
+  bool _internal_has_config() const;
+  public:
   void clear_config();
-  static const int kConfigFieldNumber = 1;
   const ::kaldi_serve::RecognitionConfig& config() const;
-  ::kaldi_serve::RecognitionConfig* release_config();
+  PROTOBUF_NODISCARD ::kaldi_serve::RecognitionConfig* release_config();
   ::kaldi_serve::RecognitionConfig* mutable_config();
   void set_allocated_config(::kaldi_serve::RecognitionConfig* config);
+  private:
+  const ::kaldi_serve::RecognitionConfig& _internal_config() const;
+  ::kaldi_serve::RecognitionConfig* _internal_mutable_config();
+  public:
+  void unsafe_arena_set_allocated_config(
+      ::kaldi_serve::RecognitionConfig* config);
+  ::kaldi_serve::RecognitionConfig* unsafe_arena_release_config();
 
   // .kaldi_serve.RecognitionAudio audio = 2;
   bool has_audio() const;
+  private:
+  bool _internal_has_audio() const;
+  public:
   void clear_audio();
-  static const int kAudioFieldNumber = 2;
   const ::kaldi_serve::RecognitionAudio& audio() const;
-  ::kaldi_serve::RecognitionAudio* release_audio();
+  PROTOBUF_NODISCARD ::kaldi_serve::RecognitionAudio* release_audio();
   ::kaldi_serve::RecognitionAudio* mutable_audio();
   void set_allocated_audio(::kaldi_serve::RecognitionAudio* audio);
+  private:
+  const ::kaldi_serve::RecognitionAudio& _internal_audio() const;
+  ::kaldi_serve::RecognitionAudio* _internal_mutable_audio();
+  public:
+  void unsafe_arena_set_allocated_audio(
+      ::kaldi_serve::RecognitionAudio* audio);
+  ::kaldi_serve::RecognitionAudio* unsafe_arena_release_audio();
 
   // @@protoc_insertion_point(class_scope:kaldi_serve.RecognizeRequest)
  private:
-  class HasBitSetters;
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr uuid_;
-  ::kaldi_serve::RecognitionConfig* config_;
-  ::kaldi_serve::RecognitionAudio* audio_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::kaldi_serve::RecognitionConfig* config_;
+    ::kaldi_serve::RecognitionAudio* audio_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kaldi_5fserve_2eproto;
 };
 // -------------------------------------------------------------------
 
 class RecognizeResponse final :
-    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.RecognizeResponse) */ {
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.RecognizeResponse) */ {
  public:
-  RecognizeResponse();
-  virtual ~RecognizeResponse();
+  inline RecognizeResponse() : RecognizeResponse(nullptr) {}
+  ~RecognizeResponse() override;
+  explicit PROTOBUF_CONSTEXPR RecognizeResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RecognizeResponse(const RecognizeResponse& from);
-
-  inline RecognizeResponse& operator=(const RecognizeResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   RecognizeResponse(RecognizeResponse&& from) noexcept
     : RecognizeResponse() {
     *this = ::std::move(from);
   }
 
+  inline RecognizeResponse& operator=(const RecognizeResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline RecognizeResponse& operator=(RecognizeResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return default_instance().GetDescriptor();
-  }
-  static const RecognizeResponse& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RecognizeResponse& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const RecognizeResponse* internal_default_instance() {
     return reinterpret_cast<const RecognizeResponse*>(
                &_RecognizeResponse_default_instance_);
@@ -293,1027 +374,1910 @@ class RecognizeResponse final :
   static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(RecognizeResponse* other);
   friend void swap(RecognizeResponse& a, RecognizeResponse& b) {
     a.Swap(&b);
   }
+  inline void Swap(RecognizeResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RecognizeResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RecognizeResponse* New() const final {
-    return CreateMaybeMessage<RecognizeResponse>(nullptr);
-  }
-
-  RecognizeResponse* New(::google::protobuf::Arena* arena) const final {
+  RecognizeResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RecognizeResponse>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RecognizeResponse& from);
-  void MergeFrom(const RecognizeResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RecognizeResponse& from) {
+    RecognizeResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  static const char* _InternalParse(const char* begin, const char* end, void* object, ::google::protobuf::internal::ParseContext* ctx);
-  ::google::protobuf::internal::ParseFunc _ParseFunc() const final { return _InternalParse; }
-  #else
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RecognizeResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kaldi_serve.RecognizeResponse";
   }
+  protected:
+  explicit RecognizeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kResultsFieldNumber = 1,
+    kSearchParamsFieldNumber = 2,
+    kFirstPassFieldNumber = 3,
+  };
   // repeated .kaldi_serve.SpeechRecognitionResult results = 1;
   int results_size() const;
+  private:
+  int _internal_results_size() const;
+  public:
   void clear_results();
-  static const int kResultsFieldNumber = 1;
   ::kaldi_serve::SpeechRecognitionResult* mutable_results(int index);
-  ::google::protobuf::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionResult >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionResult >*
       mutable_results();
+  private:
+  const ::kaldi_serve::SpeechRecognitionResult& _internal_results(int index) const;
+  ::kaldi_serve::SpeechRecognitionResult* _internal_add_results();
+  public:
   const ::kaldi_serve::SpeechRecognitionResult& results(int index) const;
   ::kaldi_serve::SpeechRecognitionResult* add_results();
-  const ::google::protobuf::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionResult >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionResult >&
       results() const;
 
+  // .kaldi_serve.SearchParams search_params = 2;
+  bool has_search_params() const;
+  private:
+  bool _internal_has_search_params() const;
+  public:
+  void clear_search_params();
+  const ::kaldi_serve::SearchParams& search_params() const;
+  PROTOBUF_NODISCARD ::kaldi_serve::SearchParams* release_search_params();
+  ::kaldi_serve::SearchParams* mutable_search_params();
+  void set_allocated_search_params(::kaldi_serve::SearchParams* search_params);
+  private:
+  const ::kaldi_serve::SearchParams& _internal_search_params() const;
+  ::kaldi_serve::SearchParams* _internal_mutable_search_params();
+  public:
+  void unsafe_arena_set_allocated_search_params(
+      ::kaldi_serve::SearchParams* search_params);
+  ::kaldi_serve::SearchParams* unsafe_arena_release_search_params();
+
+  // bool first_pass = 3;
+  void clear_first_pass();
+  bool first_pass() const;
+  void set_first_pass(bool value);
+  private:
+  bool _internal_first_pass() const;
+  void _internal_set_first_pass(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:kaldi_serve.RecognizeResponse)
  private:
-  class HasBitSetters;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionResult > results_;
+    ::kaldi_serve::SearchParams* search_params_;
+    bool first_pass_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kaldi_5fserve_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SearchParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.SearchParams) */ {
+ public:
+  inline SearchParams() : SearchParams(nullptr) {}
+  ~SearchParams() override;
+  explicit PROTOBUF_CONSTEXPR SearchParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionResult > results_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
+  SearchParams(const SearchParams& from);
+  SearchParams(SearchParams&& from) noexcept
+    : SearchParams() {
+    *this = ::std::move(from);
+  }
+
+  inline SearchParams& operator=(const SearchParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SearchParams& operator=(SearchParams&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SearchParams& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SearchParams* internal_default_instance() {
+    return reinterpret_cast<const SearchParams*>(
+               &_SearchParams_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(SearchParams& a, SearchParams& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SearchParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SearchParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SearchParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SearchParams>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SearchParams& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SearchParams& from) {
+    SearchParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SearchParams* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kaldi_serve.SearchParams";
+  }
+  protected:
+  explicit SearchParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBeamFieldNumber = 1,
+    kMaxActiveFieldNumber = 2,
+    kLatticeBeamFieldNumber = 3,
+  };
+  // float beam = 1;
+  void clear_beam();
+  float beam() const;
+  void set_beam(float value);
+  private:
+  float _internal_beam() const;
+  void _internal_set_beam(float value);
+  public:
+
+  // int32 max_active = 2;
+  void clear_max_active();
+  int32_t max_active() const;
+  void set_max_active(int32_t value);
+  private:
+  int32_t _internal_max_active() const;
+  void _internal_set_max_active(int32_t value);
+  public:
+
+  // float lattice_beam = 3;
+  void clear_lattice_beam();
+  float lattice_beam() const;
+  void set_lattice_beam(float value);
+  private:
+  float _internal_lattice_beam() const;
+  void _internal_set_lattice_beam(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:kaldi_serve.SearchParams)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    float beam_;
+    int32_t max_active_;
+    float lattice_beam_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kaldi_5fserve_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RecognitionConfig final :
-    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.RecognitionConfig) */ {
+class MetricsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:kaldi_serve.MetricsRequest) */ {
  public:
-  RecognitionConfig();
-  virtual ~RecognitionConfig();
+  inline MetricsRequest() : MetricsRequest(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR MetricsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  RecognitionConfig(const RecognitionConfig& from);
+  MetricsRequest(const MetricsRequest& from);
+  MetricsRequest(MetricsRequest&& from) noexcept
+    : MetricsRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline RecognitionConfig& operator=(const RecognitionConfig& from) {
+  inline MetricsRequest& operator=(const MetricsRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
+  inline MetricsRequest& operator=(MetricsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetricsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetricsRequest* internal_default_instance() {
+    return reinterpret_cast<const MetricsRequest*>(
+               &_MetricsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(MetricsRequest& a, MetricsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetricsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetricsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MetricsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetricsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const MetricsRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const MetricsRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kaldi_serve.MetricsRequest";
+  }
+  protected:
+  explicit MetricsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:kaldi_serve.MetricsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_kaldi_5fserve_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MetricsResponse_MetricsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MetricsResponse_MetricsEntry_DoNotUse, 
+    std::string, double,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MetricsResponse_MetricsEntry_DoNotUse, 
+    std::string, double,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE> SuperType;
+  MetricsResponse_MetricsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR MetricsResponse_MetricsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit MetricsResponse_MetricsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MetricsResponse_MetricsEntry_DoNotUse& other);
+  static const MetricsResponse_MetricsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MetricsResponse_MetricsEntry_DoNotUse*>(&_MetricsResponse_MetricsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "kaldi_serve.MetricsResponse.MetricsEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_kaldi_5fserve_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class MetricsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.MetricsResponse) */ {
+ public:
+  inline MetricsResponse() : MetricsResponse(nullptr) {}
+  ~MetricsResponse() override;
+  explicit PROTOBUF_CONSTEXPR MetricsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MetricsResponse(const MetricsResponse& from);
+  MetricsResponse(MetricsResponse&& from) noexcept
+    : MetricsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline MetricsResponse& operator=(const MetricsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MetricsResponse& operator=(MetricsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetricsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetricsResponse* internal_default_instance() {
+    return reinterpret_cast<const MetricsResponse*>(
+               &_MetricsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(MetricsResponse& a, MetricsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetricsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetricsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MetricsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetricsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MetricsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetricsResponse& from) {
+    MetricsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetricsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kaldi_serve.MetricsResponse";
+  }
+  protected:
+  explicit MetricsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMetricsFieldNumber = 1,
+  };
+  // map<string, double> metrics = 1;
+  int metrics_size() const;
+  private:
+  int _internal_metrics_size() const;
+  public:
+  void clear_metrics();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, double >&
+      _internal_metrics() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, double >*
+      _internal_mutable_metrics();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, double >&
+      metrics() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, double >*
+      mutable_metrics();
+
+  // @@protoc_insertion_point(class_scope:kaldi_serve.MetricsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        MetricsResponse_MetricsEntry_DoNotUse,
+        std::string, double,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_DOUBLE> metrics_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kaldi_5fserve_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RecognitionConfig final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.RecognitionConfig) */ {
+ public:
+  inline RecognitionConfig() : RecognitionConfig(nullptr) {}
+  ~RecognitionConfig() override;
+  explicit PROTOBUF_CONSTEXPR RecognitionConfig(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RecognitionConfig(const RecognitionConfig& from);
   RecognitionConfig(RecognitionConfig&& from) noexcept
     : RecognitionConfig() {
     *this = ::std::move(from);
   }
 
+  inline RecognitionConfig& operator=(const RecognitionConfig& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline RecognitionConfig& operator=(RecognitionConfig&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return default_instance().GetDescriptor();
-  }
-  static const RecognitionConfig& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RecognitionConfig& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const RecognitionConfig* internal_default_instance() {
     return reinterpret_cast<const RecognitionConfig*>(
                &_RecognitionConfig_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    6;
 
-  void Swap(RecognitionConfig* other);
   friend void swap(RecognitionConfig& a, RecognitionConfig& b) {
     a.Swap(&b);
   }
+  inline void Swap(RecognitionConfig* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RecognitionConfig* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RecognitionConfig* New() const final {
-    return CreateMaybeMessage<RecognitionConfig>(nullptr);
-  }
-
-  RecognitionConfig* New(::google::protobuf::Arena* arena) const final {
+  RecognitionConfig* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RecognitionConfig>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RecognitionConfig& from);
-  void MergeFrom(const RecognitionConfig& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RecognitionConfig& from) {
+    RecognitionConfig::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  static const char* _InternalParse(const char* begin, const char* end, void* object, ::google::protobuf::internal::ParseContext* ctx);
-  ::google::protobuf::internal::ParseFunc _ParseFunc() const final { return _InternalParse; }
-  #else
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RecognitionConfig* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kaldi_serve.RecognitionConfig";
   }
+  protected:
+  explicit RecognitionConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   typedef RecognitionConfig_AudioEncoding AudioEncoding;
-  static const AudioEncoding ENCODING_UNSPECIFIED =
+  static constexpr AudioEncoding ENCODING_UNSPECIFIED =
     RecognitionConfig_AudioEncoding_ENCODING_UNSPECIFIED;
-  static const AudioEncoding LINEAR16 =
+  static constexpr AudioEncoding LINEAR16 =
     RecognitionConfig_AudioEncoding_LINEAR16;
-  static const AudioEncoding FLAC =
+  static constexpr AudioEncoding FLAC =
     RecognitionConfig_AudioEncoding_FLAC;
   static inline bool AudioEncoding_IsValid(int value) {
     return RecognitionConfig_AudioEncoding_IsValid(value);
   }
-  static const AudioEncoding AudioEncoding_MIN =
+  static constexpr AudioEncoding AudioEncoding_MIN =
     RecognitionConfig_AudioEncoding_AudioEncoding_MIN;
-  static const AudioEncoding AudioEncoding_MAX =
+  static constexpr AudioEncoding AudioEncoding_MAX =
     RecognitionConfig_AudioEncoding_AudioEncoding_MAX;
-  static const int AudioEncoding_ARRAYSIZE =
+  static constexpr int AudioEncoding_ARRAYSIZE =
     RecognitionConfig_AudioEncoding_AudioEncoding_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   AudioEncoding_descriptor() {
     return RecognitionConfig_AudioEncoding_descriptor();
   }
-  static inline const ::std::string& AudioEncoding_Name(AudioEncoding value) {
-    return RecognitionConfig_AudioEncoding_Name(value);
+  template<typename T>
+  static inline const std::string& AudioEncoding_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, AudioEncoding>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function AudioEncoding_Name.");
+    return RecognitionConfig_AudioEncoding_Name(enum_t_value);
   }
-  static inline bool AudioEncoding_Parse(const ::std::string& name,
+  static inline bool AudioEncoding_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       AudioEncoding* value) {
     return RecognitionConfig_AudioEncoding_Parse(name, value);
   }
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kSpeechContextsFieldNumber = 6,
+    kLanguageCodeFieldNumber = 3,
+    kModelFieldNumber = 10,
+    kGraphFieldNumber = 18,
+    kEncodingFieldNumber = 1,
+    kSampleRateHertzFieldNumber = 2,
+    kMaxAlternativesFieldNumber = 4,
+    kAudioChannelCountFieldNumber = 7,
+    kPunctuationFieldNumber = 5,
+    kRawFieldNumber = 11,
+    kWordLevelFieldNumber = 13,
+    kTwoPassFieldNumber = 17,
+    kDataBytesFieldNumber = 12,
+    kBeamFieldNumber = 14,
+    kMaxActiveFieldNumber = 15,
+    kLatticeBeamFieldNumber = 16,
+  };
   // repeated .kaldi_serve.SpeechContext speech_contexts = 6;
   int speech_contexts_size() const;
+  private:
+  int _internal_speech_contexts_size() const;
+  public:
   void clear_speech_contexts();
-  static const int kSpeechContextsFieldNumber = 6;
   ::kaldi_serve::SpeechContext* mutable_speech_contexts(int index);
-  ::google::protobuf::RepeatedPtrField< ::kaldi_serve::SpeechContext >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechContext >*
       mutable_speech_contexts();
+  private:
+  const ::kaldi_serve::SpeechContext& _internal_speech_contexts(int index) const;
+  ::kaldi_serve::SpeechContext* _internal_add_speech_contexts();
+  public:
   const ::kaldi_serve::SpeechContext& speech_contexts(int index) const;
   ::kaldi_serve::SpeechContext* add_speech_contexts();
-  const ::google::protobuf::RepeatedPtrField< ::kaldi_serve::SpeechContext >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechContext >&
       speech_contexts() const;
 
   // string language_code = 3;
   void clear_language_code();
-  static const int kLanguageCodeFieldNumber = 3;
-  const ::std::string& language_code() const;
-  void set_language_code(const ::std::string& value);
-  #if LANG_CXX11
-  void set_language_code(::std::string&& value);
-  #endif
-  void set_language_code(const char* value);
-  void set_language_code(const char* value, size_t size);
-  ::std::string* mutable_language_code();
-  ::std::string* release_language_code();
-  void set_allocated_language_code(::std::string* language_code);
+  const std::string& language_code() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_language_code(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_language_code();
+  PROTOBUF_NODISCARD std::string* release_language_code();
+  void set_allocated_language_code(std::string* language_code);
+  private:
+  const std::string& _internal_language_code() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_language_code(const std::string& value);
+  std::string* _internal_mutable_language_code();
+  public:
 
   // string model = 10;
   void clear_model();
-  static const int kModelFieldNumber = 10;
-  const ::std::string& model() const;
-  void set_model(const ::std::string& value);
-  #if LANG_CXX11
-  void set_model(::std::string&& value);
-  #endif
-  void set_model(const char* value);
-  void set_model(const char* value, size_t size);
-  ::std::string* mutable_model();
-  ::std::string* release_model();
-  void set_allocated_model(::std::string* model);
+  const std::string& model() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_model(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_model();
+  PROTOBUF_NODISCARD std::string* release_model();
+  void set_allocated_model(std::string* model);
+  private:
+  const std::string& _internal_model() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_model(const std::string& value);
+  std::string* _internal_mutable_model();
+  public:
+
+  // string graph = 18;
+  void clear_graph();
+  const std::string& graph() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_graph(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_graph();
+  PROTOBUF_NODISCARD std::string* release_graph();
+  void set_allocated_graph(std::string* graph);
+  private:
+  const std::string& _internal_graph() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_graph(const std::string& value);
+  std::string* _internal_mutable_graph();
+  public:
 
   // .kaldi_serve.RecognitionConfig.AudioEncoding encoding = 1;
   void clear_encoding();
-  static const int kEncodingFieldNumber = 1;
   ::kaldi_serve::RecognitionConfig_AudioEncoding encoding() const;
   void set_encoding(::kaldi_serve::RecognitionConfig_AudioEncoding value);
+  private:
+  ::kaldi_serve::RecognitionConfig_AudioEncoding _internal_encoding() const;
+  void _internal_set_encoding(::kaldi_serve::RecognitionConfig_AudioEncoding value);
+  public:
 
   // int32 sample_rate_hertz = 2;
   void clear_sample_rate_hertz();
-  static const int kSampleRateHertzFieldNumber = 2;
-  ::google::protobuf::int32 sample_rate_hertz() const;
-  void set_sample_rate_hertz(::google::protobuf::int32 value);
+  int32_t sample_rate_hertz() const;
+  void set_sample_rate_hertz(int32_t value);
+  private:
+  int32_t _internal_sample_rate_hertz() const;
+  void _internal_set_sample_rate_hertz(int32_t value);
+  public:
 
   // int32 max_alternatives = 4;
   void clear_max_alternatives();
-  static const int kMaxAlternativesFieldNumber = 4;
-  ::google::protobuf::int32 max_alternatives() const;
-  void set_max_alternatives(::google::protobuf::int32 value);
+  int32_t max_alternatives() const;
+  void set_max_alternatives(int32_t value);
+  private:
+  int32_t _internal_max_alternatives() const;
+  void _internal_set_max_alternatives(int32_t value);
+  public:
 
   // int32 audio_channel_count = 7;
   void clear_audio_channel_count();
-  static const int kAudioChannelCountFieldNumber = 7;
-  ::google::protobuf::int32 audio_channel_count() const;
-  void set_audio_channel_count(::google::protobuf::int32 value);
+  int32_t audio_channel_count() const;
+  void set_audio_channel_count(int32_t value);
+  private:
+  int32_t _internal_audio_channel_count() const;
+  void _internal_set_audio_channel_count(int32_t value);
+  public:
 
   // bool punctuation = 5;
   void clear_punctuation();
-  static const int kPunctuationFieldNumber = 5;
   bool punctuation() const;
   void set_punctuation(bool value);
+  private:
+  bool _internal_punctuation() const;
+  void _internal_set_punctuation(bool value);
+  public:
 
   // bool raw = 11;
   void clear_raw();
-  static const int kRawFieldNumber = 11;
   bool raw() const;
   void set_raw(bool value);
+  private:
+  bool _internal_raw() const;
+  void _internal_set_raw(bool value);
+  public:
 
   // bool word_level = 13;
   void clear_word_level();
-  static const int kWordLevelFieldNumber = 13;
   bool word_level() const;
   void set_word_level(bool value);
+  private:
+  bool _internal_word_level() const;
+  void _internal_set_word_level(bool value);
+  public:
+
+  // bool two_pass = 17;
+  void clear_two_pass();
+  bool two_pass() const;
+  void set_two_pass(bool value);
+  private:
+  bool _internal_two_pass() const;
+  void _internal_set_two_pass(bool value);
+  public:
 
   // int32 data_bytes = 12;
   void clear_data_bytes();
-  static const int kDataBytesFieldNumber = 12;
-  ::google::protobuf::int32 data_bytes() const;
-  void set_data_bytes(::google::protobuf::int32 value);
+  int32_t data_bytes() const;
+  void set_data_bytes(int32_t value);
+  private:
+  int32_t _internal_data_bytes() const;
+  void _internal_set_data_bytes(int32_t value);
+  public:
+
+  // float beam = 14;
+  void clear_beam();
+  float beam() const;
+  void set_beam(float value);
+  private:
+  float _internal_beam() const;
+  void _internal_set_beam(float value);
+  public:
+
+  // int32 max_active = 15;
+  void clear_max_active();
+  int32_t max_active() const;
+  void set_max_active(int32_t value);
+  private:
+  int32_t _internal_max_active() const;
+  void _internal_set_max_active(int32_t value);
+  public:
+
+  // float lattice_beam = 16;
+  void clear_lattice_beam();
+  float lattice_beam() const;
+  void set_lattice_beam(float value);
+  private:
+  float _internal_lattice_beam() const;
+  void _internal_set_lattice_beam(float value);
+  public:
 
   // @@protoc_insertion_point(class_scope:kaldi_serve.RecognitionConfig)
  private:
-  class HasBitSetters;
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::kaldi_serve::SpeechContext > speech_contexts_;
-  ::google::protobuf::internal::ArenaStringPtr language_code_;
-  ::google::protobuf::internal::ArenaStringPtr model_;
-  int encoding_;
-  ::google::protobuf::int32 sample_rate_hertz_;
-  ::google::protobuf::int32 max_alternatives_;
-  ::google::protobuf::int32 audio_channel_count_;
-  bool punctuation_;
-  bool raw_;
-  bool word_level_;
-  ::google::protobuf::int32 data_bytes_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechContext > speech_contexts_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr language_code_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr model_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr graph_;
+    int encoding_;
+    int32_t sample_rate_hertz_;
+    int32_t max_alternatives_;
+    int32_t audio_channel_count_;
+    bool punctuation_;
+    bool raw_;
+    bool word_level_;
+    bool two_pass_;
+    int32_t data_bytes_;
+    float beam_;
+    int32_t max_active_;
+    float lattice_beam_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kaldi_5fserve_2eproto;
 };
 // -------------------------------------------------------------------
 
 class RecognitionAudio final :
-    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.RecognitionAudio) */ {
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.RecognitionAudio) */ {
  public:
-  RecognitionAudio();
-  virtual ~RecognitionAudio();
+  inline RecognitionAudio() : RecognitionAudio(nullptr) {}
+  ~RecognitionAudio() override;
+  explicit PROTOBUF_CONSTEXPR RecognitionAudio(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RecognitionAudio(const RecognitionAudio& from);
-
-  inline RecognitionAudio& operator=(const RecognitionAudio& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   RecognitionAudio(RecognitionAudio&& from) noexcept
     : RecognitionAudio() {
     *this = ::std::move(from);
   }
 
+  inline RecognitionAudio& operator=(const RecognitionAudio& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline RecognitionAudio& operator=(RecognitionAudio&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return default_instance().GetDescriptor();
-  }
-  static const RecognitionAudio& default_instance();
 
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RecognitionAudio& default_instance() {
+    return *internal_default_instance();
+  }
   enum AudioSourceCase {
     kContent = 1,
     kUri = 2,
     AUDIO_SOURCE_NOT_SET = 0,
   };
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const RecognitionAudio* internal_default_instance() {
     return reinterpret_cast<const RecognitionAudio*>(
                &_RecognitionAudio_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    7;
 
-  void Swap(RecognitionAudio* other);
   friend void swap(RecognitionAudio& a, RecognitionAudio& b) {
     a.Swap(&b);
   }
+  inline void Swap(RecognitionAudio* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RecognitionAudio* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RecognitionAudio* New() const final {
-    return CreateMaybeMessage<RecognitionAudio>(nullptr);
-  }
-
-  RecognitionAudio* New(::google::protobuf::Arena* arena) const final {
+  RecognitionAudio* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RecognitionAudio>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RecognitionAudio& from);
-  void MergeFrom(const RecognitionAudio& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RecognitionAudio& from) {
+    RecognitionAudio::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  static const char* _InternalParse(const char* begin, const char* end, void* object, ::google::protobuf::internal::ParseContext* ctx);
-  ::google::protobuf::internal::ParseFunc _ParseFunc() const final { return _InternalParse; }
-  #else
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RecognitionAudio* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kaldi_serve.RecognitionAudio";
   }
+  protected:
+  explicit RecognitionAudio(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kContentFieldNumber = 1,
+    kUriFieldNumber = 2,
+  };
   // bytes content = 1;
-  private:
   bool has_content() const;
+  private:
+  bool _internal_has_content() const;
   public:
   void clear_content();
-  static const int kContentFieldNumber = 1;
-  const ::std::string& content() const;
-  void set_content(const ::std::string& value);
-  #if LANG_CXX11
-  void set_content(::std::string&& value);
-  #endif
-  void set_content(const char* value);
-  void set_content(const void* value, size_t size);
-  ::std::string* mutable_content();
-  ::std::string* release_content();
-  void set_allocated_content(::std::string* content);
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
 
   // string uri = 2;
-  private:
   bool has_uri() const;
+  private:
+  bool _internal_has_uri() const;
   public:
   void clear_uri();
-  static const int kUriFieldNumber = 2;
-  const ::std::string& uri() const;
-  void set_uri(const ::std::string& value);
-  #if LANG_CXX11
-  void set_uri(::std::string&& value);
-  #endif
-  void set_uri(const char* value);
-  void set_uri(const char* value, size_t size);
-  ::std::string* mutable_uri();
-  ::std::string* release_uri();
-  void set_allocated_uri(::std::string* uri);
+  const std::string& uri() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uri(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uri();
+  PROTOBUF_NODISCARD std::string* release_uri();
+  void set_allocated_uri(std::string* uri);
+  private:
+  const std::string& _internal_uri() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uri(const std::string& value);
+  std::string* _internal_mutable_uri();
+  public:
 
   void clear_audio_source();
   AudioSourceCase audio_source_case() const;
   // @@protoc_insertion_point(class_scope:kaldi_serve.RecognitionAudio)
  private:
-  class HasBitSetters;
+  class _Internal;
   void set_has_content();
   void set_has_uri();
 
   inline bool has_audio_source() const;
   inline void clear_has_audio_source();
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  union AudioSourceUnion {
-    AudioSourceUnion() {}
-    ::google::protobuf::internal::ArenaStringPtr content_;
-    ::google::protobuf::internal::ArenaStringPtr uri_;
-  } audio_source_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  ::google::protobuf::uint32 _oneof_case_[1];
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union AudioSourceUnion {
+      constexpr AudioSourceUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uri_;
+    } audio_source_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
 
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kaldi_5fserve_2eproto;
 };
 // -------------------------------------------------------------------
 
 class SpeechRecognitionResult final :
-    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.SpeechRecognitionResult) */ {
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.SpeechRecognitionResult) */ {
  public:
-  SpeechRecognitionResult();
-  virtual ~SpeechRecognitionResult();
+  inline SpeechRecognitionResult() : SpeechRecognitionResult(nullptr) {}
+  ~SpeechRecognitionResult() override;
+  explicit PROTOBUF_CONSTEXPR SpeechRecognitionResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SpeechRecognitionResult(const SpeechRecognitionResult& from);
-
-  inline SpeechRecognitionResult& operator=(const SpeechRecognitionResult& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   SpeechRecognitionResult(SpeechRecognitionResult&& from) noexcept
     : SpeechRecognitionResult() {
     *this = ::std::move(from);
   }
 
+  inline SpeechRecognitionResult& operator=(const SpeechRecognitionResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline SpeechRecognitionResult& operator=(SpeechRecognitionResult&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return default_instance().GetDescriptor();
-  }
-  static const SpeechRecognitionResult& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SpeechRecognitionResult& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const SpeechRecognitionResult* internal_default_instance() {
     return reinterpret_cast<const SpeechRecognitionResult*>(
                &_SpeechRecognitionResult_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    8;
 
-  void Swap(SpeechRecognitionResult* other);
   friend void swap(SpeechRecognitionResult& a, SpeechRecognitionResult& b) {
     a.Swap(&b);
   }
+  inline void Swap(SpeechRecognitionResult* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SpeechRecognitionResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SpeechRecognitionResult* New() const final {
-    return CreateMaybeMessage<SpeechRecognitionResult>(nullptr);
-  }
-
-  SpeechRecognitionResult* New(::google::protobuf::Arena* arena) const final {
+  SpeechRecognitionResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SpeechRecognitionResult>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SpeechRecognitionResult& from);
-  void MergeFrom(const SpeechRecognitionResult& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SpeechRecognitionResult& from) {
+    SpeechRecognitionResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  static const char* _InternalParse(const char* begin, const char* end, void* object, ::google::protobuf::internal::ParseContext* ctx);
-  ::google::protobuf::internal::ParseFunc _ParseFunc() const final { return _InternalParse; }
-  #else
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SpeechRecognitionResult* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kaldi_serve.SpeechRecognitionResult";
   }
+  protected:
+  explicit SpeechRecognitionResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kAlternativesFieldNumber = 1,
+  };
   // repeated .kaldi_serve.SpeechRecognitionAlternative alternatives = 1;
   int alternatives_size() const;
+  private:
+  int _internal_alternatives_size() const;
+  public:
   void clear_alternatives();
-  static const int kAlternativesFieldNumber = 1;
   ::kaldi_serve::SpeechRecognitionAlternative* mutable_alternatives(int index);
-  ::google::protobuf::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionAlternative >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionAlternative >*
       mutable_alternatives();
+  private:
+  const ::kaldi_serve::SpeechRecognitionAlternative& _internal_alternatives(int index) const;
+  ::kaldi_serve::SpeechRecognitionAlternative* _internal_add_alternatives();
+  public:
   const ::kaldi_serve::SpeechRecognitionAlternative& alternatives(int index) const;
   ::kaldi_serve::SpeechRecognitionAlternative* add_alternatives();
-  const ::google::protobuf::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionAlternative >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionAlternative >&
       alternatives() const;
 
   // @@protoc_insertion_point(class_scope:kaldi_serve.SpeechRecognitionResult)
  private:
-  class HasBitSetters;
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionAlternative > alternatives_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionAlternative > alternatives_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kaldi_5fserve_2eproto;
 };
 // -------------------------------------------------------------------
 
 class SpeechRecognitionAlternative final :
-    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.SpeechRecognitionAlternative) */ {
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.SpeechRecognitionAlternative) */ {
  public:
-  SpeechRecognitionAlternative();
-  virtual ~SpeechRecognitionAlternative();
+  inline SpeechRecognitionAlternative() : SpeechRecognitionAlternative(nullptr) {}
+  ~SpeechRecognitionAlternative() override;
+  explicit PROTOBUF_CONSTEXPR SpeechRecognitionAlternative(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SpeechRecognitionAlternative(const SpeechRecognitionAlternative& from);
-
-  inline SpeechRecognitionAlternative& operator=(const SpeechRecognitionAlternative& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   SpeechRecognitionAlternative(SpeechRecognitionAlternative&& from) noexcept
     : SpeechRecognitionAlternative() {
     *this = ::std::move(from);
   }
 
+  inline SpeechRecognitionAlternative& operator=(const SpeechRecognitionAlternative& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline SpeechRecognitionAlternative& operator=(SpeechRecognitionAlternative&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return default_instance().GetDescriptor();
-  }
-  static const SpeechRecognitionAlternative& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SpeechRecognitionAlternative& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const SpeechRecognitionAlternative* internal_default_instance() {
     return reinterpret_cast<const SpeechRecognitionAlternative*>(
                &_SpeechRecognitionAlternative_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    9;
 
-  void Swap(SpeechRecognitionAlternative* other);
   friend void swap(SpeechRecognitionAlternative& a, SpeechRecognitionAlternative& b) {
     a.Swap(&b);
   }
+  inline void Swap(SpeechRecognitionAlternative* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SpeechRecognitionAlternative* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SpeechRecognitionAlternative* New() const final {
-    return CreateMaybeMessage<SpeechRecognitionAlternative>(nullptr);
-  }
-
-  SpeechRecognitionAlternative* New(::google::protobuf::Arena* arena) const final {
+  SpeechRecognitionAlternative* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SpeechRecognitionAlternative>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SpeechRecognitionAlternative& from);
-  void MergeFrom(const SpeechRecognitionAlternative& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SpeechRecognitionAlternative& from) {
+    SpeechRecognitionAlternative::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  static const char* _InternalParse(const char* begin, const char* end, void* object, ::google::protobuf::internal::ParseContext* ctx);
-  ::google::protobuf::internal::ParseFunc _ParseFunc() const final { return _InternalParse; }
-  #else
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SpeechRecognitionAlternative* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kaldi_serve.SpeechRecognitionAlternative";
   }
+  protected:
+  explicit SpeechRecognitionAlternative(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kWordsFieldNumber = 5,
+    kTranscriptFieldNumber = 1,
+    kConfidenceFieldNumber = 2,
+    kAmScoreFieldNumber = 3,
+    kLmScoreFieldNumber = 4,
+  };
   // repeated .kaldi_serve.Word words = 5;
   int words_size() const;
+  private:
+  int _internal_words_size() const;
+  public:
   void clear_words();
-  static const int kWordsFieldNumber = 5;
   ::kaldi_serve::Word* mutable_words(int index);
-  ::google::protobuf::RepeatedPtrField< ::kaldi_serve::Word >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::Word >*
       mutable_words();
+  private:
+  const ::kaldi_serve::Word& _internal_words(int index) const;
+  ::kaldi_serve::Word* _internal_add_words();
+  public:
   const ::kaldi_serve::Word& words(int index) const;
   ::kaldi_serve::Word* add_words();
-  const ::google::protobuf::RepeatedPtrField< ::kaldi_serve::Word >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::Word >&
       words() const;
 
   // string transcript = 1;
   void clear_transcript();
-  static const int kTranscriptFieldNumber = 1;
-  const ::std::string& transcript() const;
-  void set_transcript(const ::std::string& value);
-  #if LANG_CXX11
-  void set_transcript(::std::string&& value);
-  #endif
-  void set_transcript(const char* value);
-  void set_transcript(const char* value, size_t size);
-  ::std::string* mutable_transcript();
-  ::std::string* release_transcript();
-  void set_allocated_transcript(::std::string* transcript);
+  const std::string& transcript() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_transcript(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_transcript();
+  PROTOBUF_NODISCARD std::string* release_transcript();
+  void set_allocated_transcript(std::string* transcript);
+  private:
+  const std::string& _internal_transcript() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_transcript(const std::string& value);
+  std::string* _internal_mutable_transcript();
+  public:
 
   // float confidence = 2;
   void clear_confidence();
-  static const int kConfidenceFieldNumber = 2;
   float confidence() const;
   void set_confidence(float value);
+  private:
+  float _internal_confidence() const;
+  void _internal_set_confidence(float value);
+  public:
 
   // float am_score = 3;
   void clear_am_score();
-  static const int kAmScoreFieldNumber = 3;
   float am_score() const;
   void set_am_score(float value);
+  private:
+  float _internal_am_score() const;
+  void _internal_set_am_score(float value);
+  public:
 
   // float lm_score = 4;
   void clear_lm_score();
-  static const int kLmScoreFieldNumber = 4;
   float lm_score() const;
   void set_lm_score(float value);
+  private:
+  float _internal_lm_score() const;
+  void _internal_set_lm_score(float value);
+  public:
 
   // @@protoc_insertion_point(class_scope:kaldi_serve.SpeechRecognitionAlternative)
  private:
-  class HasBitSetters;
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::kaldi_serve::Word > words_;
-  ::google::protobuf::internal::ArenaStringPtr transcript_;
-  float confidence_;
-  float am_score_;
-  float lm_score_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::Word > words_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr transcript_;
+    float confidence_;
+    float am_score_;
+    float lm_score_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kaldi_5fserve_2eproto;
 };
 // -------------------------------------------------------------------
 
 class Word final :
-    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.Word) */ {
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.Word) */ {
  public:
-  Word();
-  virtual ~Word();
+  inline Word() : Word(nullptr) {}
+  ~Word() override;
+  explicit PROTOBUF_CONSTEXPR Word(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Word(const Word& from);
-
-  inline Word& operator=(const Word& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Word(Word&& from) noexcept
     : Word() {
     *this = ::std::move(from);
   }
 
+  inline Word& operator=(const Word& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Word& operator=(Word&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return default_instance().GetDescriptor();
-  }
-  static const Word& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Word& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Word* internal_default_instance() {
     return reinterpret_cast<const Word*>(
                &_Word_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    10;
 
-  void Swap(Word* other);
   friend void swap(Word& a, Word& b) {
     a.Swap(&b);
   }
+  inline void Swap(Word* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Word* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Word* New() const final {
-    return CreateMaybeMessage<Word>(nullptr);
-  }
-
-  Word* New(::google::protobuf::Arena* arena) const final {
+  Word* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Word>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Word& from);
-  void MergeFrom(const Word& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Word& from) {
+    Word::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  static const char* _InternalParse(const char* begin, const char* end, void* object, ::google::protobuf::internal::ParseContext* ctx);
-  ::google::protobuf::internal::ParseFunc _ParseFunc() const final { return _InternalParse; }
-  #else
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Word* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kaldi_serve.Word";
   }
+  protected:
+  explicit Word(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kWordFieldNumber = 3,
+    kStartTimeFieldNumber = 1,
+    kEndTimeFieldNumber = 2,
+    kConfidenceFieldNumber = 4,
+  };
   // string word = 3;
   void clear_word();
-  static const int kWordFieldNumber = 3;
-  const ::std::string& word() const;
-  void set_word(const ::std::string& value);
-  #if LANG_CXX11
-  void set_word(::std::string&& value);
-  #endif
-  void set_word(const char* value);
-  void set_word(const char* value, size_t size);
-  ::std::string* mutable_word();
-  ::std::string* release_word();
-  void set_allocated_word(::std::string* word);
+  const std::string& word() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_word(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_word();
+  PROTOBUF_NODISCARD std::string* release_word();
+  void set_allocated_word(std::string* word);
+  private:
+  const std::string& _internal_word() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_word(const std::string& value);
+  std::string* _internal_mutable_word();
+  public:
 
   // float start_time = 1;
   void clear_start_time();
-  static const int kStartTimeFieldNumber = 1;
   float start_time() const;
   void set_start_time(float value);
+  private:
+  float _internal_start_time() const;
+  void _internal_set_start_time(float value);
+  public:
 
   // float end_time = 2;
   void clear_end_time();
-  static const int kEndTimeFieldNumber = 2;
   float end_time() const;
   void set_end_time(float value);
+  private:
+  float _internal_end_time() const;
+  void _internal_set_end_time(float value);
+  public:
 
   // float confidence = 4;
   void clear_confidence();
-  static const int kConfidenceFieldNumber = 4;
   float confidence() const;
   void set_confidence(float value);
+  private:
+  float _internal_confidence() const;
+  void _internal_set_confidence(float value);
+  public:
 
   // @@protoc_insertion_point(class_scope:kaldi_serve.Word)
  private:
-  class HasBitSetters;
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr word_;
-  float start_time_;
-  float end_time_;
-  float confidence_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr word_;
+    float start_time_;
+    float end_time_;
+    float confidence_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kaldi_5fserve_2eproto;
 };
 // -------------------------------------------------------------------
 
 class SpeechContext final :
-    public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.SpeechContext) */ {
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.SpeechContext) */ {
  public:
-  SpeechContext();
-  virtual ~SpeechContext();
+  inline SpeechContext() : SpeechContext(nullptr) {}
+  ~SpeechContext() override;
+  explicit PROTOBUF_CONSTEXPR SpeechContext(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SpeechContext(const SpeechContext& from);
-
-  inline SpeechContext& operator=(const SpeechContext& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   SpeechContext(SpeechContext&& from) noexcept
     : SpeechContext() {
     *this = ::std::move(from);
   }
 
+  inline SpeechContext& operator=(const SpeechContext& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline SpeechContext& operator=(SpeechContext&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor() {
-    return default_instance().GetDescriptor();
-  }
-  static const SpeechContext& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SpeechContext& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const SpeechContext* internal_default_instance() {
     return reinterpret_cast<const SpeechContext*>(
                &_SpeechContext_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    7;
+    11;
 
-  void Swap(SpeechContext* other);
   friend void swap(SpeechContext& a, SpeechContext& b) {
     a.Swap(&b);
   }
+  inline void Swap(SpeechContext* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SpeechContext* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SpeechContext* New() const final {
-    return CreateMaybeMessage<SpeechContext>(nullptr);
-  }
-
-  SpeechContext* New(::google::protobuf::Arena* arena) const final {
+  SpeechContext* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SpeechContext>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SpeechContext& from);
-  void MergeFrom(const SpeechContext& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SpeechContext& from) {
+    SpeechContext::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  static const char* _InternalParse(const char* begin, const char* end, void* object, ::google::protobuf::internal::ParseContext* ctx);
-  ::google::protobuf::internal::ParseFunc _ParseFunc() const final { return _InternalParse; }
-  #else
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SpeechContext* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kaldi_serve.SpeechContext";
   }
+  protected:
+  explicit SpeechContext(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kPhrasesFieldNumber = 1,
+    kTypeFieldNumber = 2,
+  };
   // repeated string phrases = 1;
   int phrases_size() const;
+  private:
+  int _internal_phrases_size() const;
+  public:
   void clear_phrases();
-  static const int kPhrasesFieldNumber = 1;
-  const ::std::string& phrases(int index) const;
-  ::std::string* mutable_phrases(int index);
-  void set_phrases(int index, const ::std::string& value);
-  #if LANG_CXX11
-  void set_phrases(int index, ::std::string&& value);
-  #endif
+  const std::string& phrases(int index) const;
+  std::string* mutable_phrases(int index);
+  void set_phrases(int index, const std::string& value);
+  void set_phrases(int index, std::string&& value);
   void set_phrases(int index, const char* value);
   void set_phrases(int index, const char* value, size_t size);
-  ::std::string* add_phrases();
-  void add_phrases(const ::std::string& value);
-  #if LANG_CXX11
-  void add_phrases(::std::string&& value);
-  #endif
+  std::string* add_phrases();
+  void add_phrases(const std::string& value);
+  void add_phrases(std::string&& value);
   void add_phrases(const char* value);
   void add_phrases(const char* value, size_t size);
-  const ::google::protobuf::RepeatedPtrField<::std::string>& phrases() const;
-  ::google::protobuf::RepeatedPtrField<::std::string>* mutable_phrases();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& phrases() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_phrases();
+  private:
+  const std::string& _internal_phrases(int index) const;
+  std::string* _internal_add_phrases();
+  public:
 
   // string type = 2;
   void clear_type();
-  static const int kTypeFieldNumber = 2;
-  const ::std::string& type() const;
-  void set_type(const ::std::string& value);
-  #if LANG_CXX11
-  void set_type(::std::string&& value);
-  #endif
-  void set_type(const char* value);
-  void set_type(const char* value, size_t size);
-  ::std::string* mutable_type();
-  ::std::string* release_type();
-  void set_allocated_type(::std::string* type);
+  const std::string& type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_type();
+  PROTOBUF_NODISCARD std::string* release_type();
+  void set_allocated_type(std::string* type);
+  private:
+  const std::string& _internal_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_type(const std::string& value);
+  std::string* _internal_mutable_type();
+  public:
 
   // @@protoc_insertion_point(class_scope:kaldi_serve.SpeechContext)
  private:
-  class HasBitSetters;
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField<::std::string> phrases_;
-  ::google::protobuf::internal::ArenaStringPtr type_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> phrases_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kaldi_5fserve_2eproto;
 };
 // ===================================================================
@@ -1328,192 +2292,490 @@ class SpeechContext final :
 // RecognizeRequest
 
 // .kaldi_serve.RecognitionConfig config = 1;
+inline bool RecognizeRequest::_internal_has_config() const {
+  return this != internal_default_instance() && _impl_.config_ != nullptr;
+}
 inline bool RecognizeRequest::has_config() const {
-  return this != internal_default_instance() && config_ != nullptr;
+  return _internal_has_config();
 }
 inline void RecognizeRequest::clear_config() {
-  if (GetArenaNoVirtual() == nullptr && config_ != nullptr) {
-    delete config_;
+  if (GetArenaForAllocation() == nullptr && _impl_.config_ != nullptr) {
+    delete _impl_.config_;
   }
-  config_ = nullptr;
+  _impl_.config_ = nullptr;
+}
+inline const ::kaldi_serve::RecognitionConfig& RecognizeRequest::_internal_config() const {
+  const ::kaldi_serve::RecognitionConfig* p = _impl_.config_;
+  return p != nullptr ? *p : reinterpret_cast<const ::kaldi_serve::RecognitionConfig&>(
+      ::kaldi_serve::_RecognitionConfig_default_instance_);
 }
 inline const ::kaldi_serve::RecognitionConfig& RecognizeRequest::config() const {
-  const ::kaldi_serve::RecognitionConfig* p = config_;
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognizeRequest.config)
-  return p != nullptr ? *p : *reinterpret_cast<const ::kaldi_serve::RecognitionConfig*>(
-      &::kaldi_serve::_RecognitionConfig_default_instance_);
+  return _internal_config();
+}
+inline void RecognizeRequest::unsafe_arena_set_allocated_config(
+    ::kaldi_serve::RecognitionConfig* config) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.config_);
+  }
+  _impl_.config_ = config;
+  if (config) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kaldi_serve.RecognizeRequest.config)
 }
 inline ::kaldi_serve::RecognitionConfig* RecognizeRequest::release_config() {
+  
+  ::kaldi_serve::RecognitionConfig* temp = _impl_.config_;
+  _impl_.config_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::kaldi_serve::RecognitionConfig* RecognizeRequest::unsafe_arena_release_config() {
   // @@protoc_insertion_point(field_release:kaldi_serve.RecognizeRequest.config)
   
-  ::kaldi_serve::RecognitionConfig* temp = config_;
-  config_ = nullptr;
+  ::kaldi_serve::RecognitionConfig* temp = _impl_.config_;
+  _impl_.config_ = nullptr;
   return temp;
 }
-inline ::kaldi_serve::RecognitionConfig* RecognizeRequest::mutable_config() {
+inline ::kaldi_serve::RecognitionConfig* RecognizeRequest::_internal_mutable_config() {
   
-  if (config_ == nullptr) {
-    auto* p = CreateMaybeMessage<::kaldi_serve::RecognitionConfig>(GetArenaNoVirtual());
-    config_ = p;
+  if (_impl_.config_ == nullptr) {
+    auto* p = CreateMaybeMessage<::kaldi_serve::RecognitionConfig>(GetArenaForAllocation());
+    _impl_.config_ = p;
   }
+  return _impl_.config_;
+}
+inline ::kaldi_serve::RecognitionConfig* RecognizeRequest::mutable_config() {
+  ::kaldi_serve::RecognitionConfig* _msg = _internal_mutable_config();
   // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognizeRequest.config)
-  return config_;
+  return _msg;
 }
 inline void RecognizeRequest::set_allocated_config(::kaldi_serve::RecognitionConfig* config) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete config_;
+    delete _impl_.config_;
   }
   if (config) {
-    ::google::protobuf::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(config);
     if (message_arena != submessage_arena) {
-      config = ::google::protobuf::internal::GetOwnedMessage(
+      config = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, config, submessage_arena);
     }
     
   } else {
     
   }
-  config_ = config;
+  _impl_.config_ = config;
   // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognizeRequest.config)
 }
 
 // .kaldi_serve.RecognitionAudio audio = 2;
+inline bool RecognizeRequest::_internal_has_audio() const {
+  return this != internal_default_instance() && _impl_.audio_ != nullptr;
+}
 inline bool RecognizeRequest::has_audio() const {
-  return this != internal_default_instance() && audio_ != nullptr;
+  return _internal_has_audio();
 }
 inline void RecognizeRequest::clear_audio() {
-  if (GetArenaNoVirtual() == nullptr && audio_ != nullptr) {
-    delete audio_;
+  if (GetArenaForAllocation() == nullptr && _impl_.audio_ != nullptr) {
+    delete _impl_.audio_;
   }
-  audio_ = nullptr;
+  _impl_.audio_ = nullptr;
+}
+inline const ::kaldi_serve::RecognitionAudio& RecognizeRequest::_internal_audio() const {
+  const ::kaldi_serve::RecognitionAudio* p = _impl_.audio_;
+  return p != nullptr ? *p : reinterpret_cast<const ::kaldi_serve::RecognitionAudio&>(
+      ::kaldi_serve::_RecognitionAudio_default_instance_);
 }
 inline const ::kaldi_serve::RecognitionAudio& RecognizeRequest::audio() const {
-  const ::kaldi_serve::RecognitionAudio* p = audio_;
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognizeRequest.audio)
-  return p != nullptr ? *p : *reinterpret_cast<const ::kaldi_serve::RecognitionAudio*>(
-      &::kaldi_serve::_RecognitionAudio_default_instance_);
+  return _internal_audio();
+}
+inline void RecognizeRequest::unsafe_arena_set_allocated_audio(
+    ::kaldi_serve::RecognitionAudio* audio) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.audio_);
+  }
+  _impl_.audio_ = audio;
+  if (audio) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kaldi_serve.RecognizeRequest.audio)
+}
+inline ::kaldi_serve::RecognitionAudio* RecognizeRequest::release_audio() {
+  
+  ::kaldi_serve::RecognitionAudio* temp = _impl_.audio_;
+  _impl_.audio_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::kaldi_serve::RecognitionAudio* RecognizeRequest::unsafe_arena_release_audio() {
+  // @@protoc_insertion_point(field_release:kaldi_serve.RecognizeRequest.audio)
+  
+  ::kaldi_serve::RecognitionAudio* temp = _impl_.audio_;
+  _impl_.audio_ = nullptr;
+  return temp;
+}
+inline ::kaldi_serve::RecognitionAudio* RecognizeRequest::_internal_mutable_audio() {
+  
+  if (_impl_.audio_ == nullptr) {
+    auto* p = CreateMaybeMessage<::kaldi_serve::RecognitionAudio>(GetArenaForAllocation());
+    _impl_.audio_ = p;
+  }
+  return _impl_.audio_;
+}
+inline ::kaldi_serve::RecognitionAudio* RecognizeRequest::mutable_audio() {
+  ::kaldi_serve::RecognitionAudio* _msg = _internal_mutable_audio();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognizeRequest.audio)
+  return _msg;
+}
+inline void RecognizeRequest::set_allocated_audio(::kaldi_serve::RecognitionAudio* audio) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.audio_;
+  }
+  if (audio) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(audio);
+    if (message_arena != submessage_arena) {
+      audio = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, audio, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.audio_ = audio;
+  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognizeRequest.audio)
+}
+
+// string uuid = 3;
+inline void RecognizeRequest::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+}
+inline const std::string& RecognizeRequest::uuid() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.RecognizeRequest.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RecognizeRequest::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kaldi_serve.RecognizeRequest.uuid)
+}
+inline std::string* RecognizeRequest::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognizeRequest.uuid)
+  return _s;
+}
+inline const std::string& RecognizeRequest::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void RecognizeRequest::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RecognizeRequest::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RecognizeRequest::release_uuid() {
+  // @@protoc_insertion_point(field_release:kaldi_serve.RecognizeRequest.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void RecognizeRequest::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognizeRequest.uuid)
+}
+
+// -------------------------------------------------------------------
+
+// RecognizeResponse
+
+// repeated .kaldi_serve.SpeechRecognitionResult results = 1;
+inline int RecognizeResponse::_internal_results_size() const {
+  return _impl_.results_.size();
+}
+inline int RecognizeResponse::results_size() const {
+  return _internal_results_size();
+}
+inline void RecognizeResponse::clear_results() {
+  _impl_.results_.Clear();
+}
+inline ::kaldi_serve::SpeechRecognitionResult* RecognizeResponse::mutable_results(int index) {
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognizeResponse.results)
+  return _impl_.results_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionResult >*
+RecognizeResponse::mutable_results() {
+  // @@protoc_insertion_point(field_mutable_list:kaldi_serve.RecognizeResponse.results)
+  return &_impl_.results_;
+}
+inline const ::kaldi_serve::SpeechRecognitionResult& RecognizeResponse::_internal_results(int index) const {
+  return _impl_.results_.Get(index);
+}
+inline const ::kaldi_serve::SpeechRecognitionResult& RecognizeResponse::results(int index) const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.RecognizeResponse.results)
+  return _internal_results(index);
+}
+inline ::kaldi_serve::SpeechRecognitionResult* RecognizeResponse::_internal_add_results() {
+  return _impl_.results_.Add();
+}
+inline ::kaldi_serve::SpeechRecognitionResult* RecognizeResponse::add_results() {
+  ::kaldi_serve::SpeechRecognitionResult* _add = _internal_add_results();
+  // @@protoc_insertion_point(field_add:kaldi_serve.RecognizeResponse.results)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionResult >&
+RecognizeResponse::results() const {
+  // @@protoc_insertion_point(field_list:kaldi_serve.RecognizeResponse.results)
+  return _impl_.results_;
+}
+
+// .kaldi_serve.SearchParams search_params = 2;
+inline bool RecognizeResponse::_internal_has_search_params() const {
+  return this != internal_default_instance() && _impl_.search_params_ != nullptr;
+}
+inline bool RecognizeResponse::has_search_params() const {
+  return _internal_has_search_params();
+}
+inline void RecognizeResponse::clear_search_params() {
+  if (GetArenaForAllocation() == nullptr && _impl_.search_params_ != nullptr) {
+    delete _impl_.search_params_;
+  }
+  _impl_.search_params_ = nullptr;
+}
+inline const ::kaldi_serve::SearchParams& RecognizeResponse::_internal_search_params() const {
+  const ::kaldi_serve::SearchParams* p = _impl_.search_params_;
+  return p != nullptr ? *p : reinterpret_cast<const ::kaldi_serve::SearchParams&>(
+      ::kaldi_serve::_SearchParams_default_instance_);
+}
+inline const ::kaldi_serve::SearchParams& RecognizeResponse::search_params() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.RecognizeResponse.search_params)
+  return _internal_search_params();
+}
+inline void RecognizeResponse::unsafe_arena_set_allocated_search_params(
+    ::kaldi_serve::SearchParams* search_params) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.search_params_);
+  }
+  _impl_.search_params_ = search_params;
+  if (search_params) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kaldi_serve.RecognizeResponse.search_params)
 }
-inline ::kaldi_serve::RecognitionAudio* RecognizeRequest::release_audio() {
-  // @@protoc_insertion_point(field_release:kaldi_serve.RecognizeRequest.audio)
+inline ::kaldi_serve::SearchParams* RecognizeResponse::release_search_params() {
   
-  ::kaldi_serve::RecognitionAudio* temp = audio_;
-  audio_ = nullptr;
+  ::kaldi_serve::SearchParams* temp = _impl_.search_params_;
+  _impl_.search_params_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::kaldi_serve::RecognitionAudio* RecognizeRequest::mutable_audio() {
+inline ::kaldi_serve::SearchParams* RecognizeResponse::unsafe_arena_release_search_params() {
+  // @@protoc_insertion_point(field_release:kaldi_serve.RecognizeResponse.search_params)
+  
+  ::kaldi_serve::SearchParams* temp = _impl_.search_params_;
+  _impl_.search_params_ = nullptr;
+  return temp;
+}
+inline ::kaldi_serve::SearchParams* RecognizeResponse::_internal_mutable_search_params() {
   
-  if (audio_ == nullptr) {
-    auto* p = CreateMaybeMessage<::kaldi_serve::RecognitionAudio>(GetArenaNoVirtual());
-    audio_ = p;
+  if (_impl_.search_params_ == nullptr) {
+    auto* p = CreateMaybeMessage<::kaldi_serve::SearchParams>(GetArenaForAllocation());
+    _impl_.search_params_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognizeRequest.audio)
-  return audio_;
+  return _impl_.search_params_;
 }
-inline void RecognizeRequest::set_allocated_audio(::kaldi_serve::RecognitionAudio* audio) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+inline ::kaldi_serve::SearchParams* RecognizeResponse::mutable_search_params() {
+  ::kaldi_serve::SearchParams* _msg = _internal_mutable_search_params();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognizeResponse.search_params)
+  return _msg;
+}
+inline void RecognizeResponse::set_allocated_search_params(::kaldi_serve::SearchParams* search_params) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete audio_;
+    delete _impl_.search_params_;
   }
-  if (audio) {
-    ::google::protobuf::Arena* submessage_arena = nullptr;
+  if (search_params) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(search_params);
     if (message_arena != submessage_arena) {
-      audio = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, audio, submessage_arena);
+      search_params = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, search_params, submessage_arena);
     }
     
   } else {
     
   }
-  audio_ = audio;
-  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognizeRequest.audio)
+  _impl_.search_params_ = search_params;
+  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognizeResponse.search_params)
 }
 
-// string uuid = 3;
-inline void RecognizeRequest::clear_uuid() {
-  uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// bool first_pass = 3;
+inline void RecognizeResponse::clear_first_pass() {
+  _impl_.first_pass_ = false;
 }
-inline const ::std::string& RecognizeRequest::uuid() const {
-  // @@protoc_insertion_point(field_get:kaldi_serve.RecognizeRequest.uuid)
-  return uuid_.GetNoArena();
+inline bool RecognizeResponse::_internal_first_pass() const {
+  return _impl_.first_pass_;
 }
-inline void RecognizeRequest::set_uuid(const ::std::string& value) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:kaldi_serve.RecognizeRequest.uuid)
+inline bool RecognizeResponse::first_pass() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.RecognizeResponse.first_pass)
+  return _internal_first_pass();
 }
-#if LANG_CXX11
-inline void RecognizeRequest::set_uuid(::std::string&& value) {
+inline void RecognizeResponse::_internal_set_first_pass(bool value) {
   
-  uuid_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kaldi_serve.RecognizeRequest.uuid)
+  _impl_.first_pass_ = value;
 }
-#endif
-inline void RecognizeRequest::set_uuid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kaldi_serve.RecognizeRequest.uuid)
+inline void RecognizeResponse::set_first_pass(bool value) {
+  _internal_set_first_pass(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.RecognizeResponse.first_pass)
+}
+
+// -------------------------------------------------------------------
+
+// SearchParams
+
+// float beam = 1;
+inline void SearchParams::clear_beam() {
+  _impl_.beam_ = 0;
+}
+inline float SearchParams::_internal_beam() const {
+  return _impl_.beam_;
 }
-inline void RecognizeRequest::set_uuid(const char* value, size_t size) {
+inline float SearchParams::beam() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.SearchParams.beam)
+  return _internal_beam();
+}
+inline void SearchParams::_internal_set_beam(float value) {
   
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kaldi_serve.RecognizeRequest.uuid)
+  _impl_.beam_ = value;
+}
+inline void SearchParams::set_beam(float value) {
+  _internal_set_beam(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.SearchParams.beam)
+}
+
+// int32 max_active = 2;
+inline void SearchParams::clear_max_active() {
+  _impl_.max_active_ = 0;
+}
+inline int32_t SearchParams::_internal_max_active() const {
+  return _impl_.max_active_;
+}
+inline int32_t SearchParams::max_active() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.SearchParams.max_active)
+  return _internal_max_active();
 }
-inline ::std::string* RecognizeRequest::mutable_uuid() {
+inline void SearchParams::_internal_set_max_active(int32_t value) {
   
-  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognizeRequest.uuid)
-  return uuid_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.max_active_ = value;
 }
-inline ::std::string* RecognizeRequest::release_uuid() {
-  // @@protoc_insertion_point(field_release:kaldi_serve.RecognizeRequest.uuid)
+inline void SearchParams::set_max_active(int32_t value) {
+  _internal_set_max_active(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.SearchParams.max_active)
+}
+
+// float lattice_beam = 3;
+inline void SearchParams::clear_lattice_beam() {
+  _impl_.lattice_beam_ = 0;
+}
+inline float SearchParams::_internal_lattice_beam() const {
+  return _impl_.lattice_beam_;
+}
+inline float SearchParams::lattice_beam() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.SearchParams.lattice_beam)
+  return _internal_lattice_beam();
+}
+inline void SearchParams::_internal_set_lattice_beam(float value) {
   
-  return uuid_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.lattice_beam_ = value;
 }
-inline void RecognizeRequest::set_allocated_uuid(::std::string* uuid) {
-  if (uuid != nullptr) {
-    
-  } else {
-    
-  }
-  uuid_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), uuid);
-  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognizeRequest.uuid)
+inline void SearchParams::set_lattice_beam(float value) {
+  _internal_set_lattice_beam(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.SearchParams.lattice_beam)
 }
 
 // -------------------------------------------------------------------
 
-// RecognizeResponse
+// MetricsRequest
 
-// repeated .kaldi_serve.SpeechRecognitionResult results = 1;
-inline int RecognizeResponse::results_size() const {
-  return results_.size();
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// MetricsResponse
+
+// map<string, double> metrics = 1;
+inline int MetricsResponse::_internal_metrics_size() const {
+  return _impl_.metrics_.size();
 }
-inline void RecognizeResponse::clear_results() {
-  results_.Clear();
+inline int MetricsResponse::metrics_size() const {
+  return _internal_metrics_size();
 }
-inline ::kaldi_serve::SpeechRecognitionResult* RecognizeResponse::mutable_results(int index) {
-  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognizeResponse.results)
-  return results_.Mutable(index);
+inline void MetricsResponse::clear_metrics() {
+  _impl_.metrics_.Clear();
 }
-inline ::google::protobuf::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionResult >*
-RecognizeResponse::mutable_results() {
-  // @@protoc_insertion_point(field_mutable_list:kaldi_serve.RecognizeResponse.results)
-  return &results_;
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, double >&
+MetricsResponse::_internal_metrics() const {
+  return _impl_.metrics_.GetMap();
 }
-inline const ::kaldi_serve::SpeechRecognitionResult& RecognizeResponse::results(int index) const {
-  // @@protoc_insertion_point(field_get:kaldi_serve.RecognizeResponse.results)
-  return results_.Get(index);
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, double >&
+MetricsResponse::metrics() const {
+  // @@protoc_insertion_point(field_map:kaldi_serve.MetricsResponse.metrics)
+  return _internal_metrics();
 }
-inline ::kaldi_serve::SpeechRecognitionResult* RecognizeResponse::add_results() {
-  // @@protoc_insertion_point(field_add:kaldi_serve.RecognizeResponse.results)
-  return results_.Add();
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, double >*
+MetricsResponse::_internal_mutable_metrics() {
+  return _impl_.metrics_.MutableMap();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionResult >&
-RecognizeResponse::results() const {
-  // @@protoc_insertion_point(field_list:kaldi_serve.RecognizeResponse.results)
-  return results_;
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, double >*
+MetricsResponse::mutable_metrics() {
+  // @@protoc_insertion_point(field_mutable_map:kaldi_serve.MetricsResponse.metrics)
+  return _internal_mutable_metrics();
 }
 
 // -------------------------------------------------------------------
@@ -1522,436 +2784,588 @@ RecognizeResponse::results() const {
 
 // .kaldi_serve.RecognitionConfig.AudioEncoding encoding = 1;
 inline void RecognitionConfig::clear_encoding() {
-  encoding_ = 0;
+  _impl_.encoding_ = 0;
+}
+inline ::kaldi_serve::RecognitionConfig_AudioEncoding RecognitionConfig::_internal_encoding() const {
+  return static_cast< ::kaldi_serve::RecognitionConfig_AudioEncoding >(_impl_.encoding_);
 }
 inline ::kaldi_serve::RecognitionConfig_AudioEncoding RecognitionConfig::encoding() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.encoding)
-  return static_cast< ::kaldi_serve::RecognitionConfig_AudioEncoding >(encoding_);
+  return _internal_encoding();
 }
-inline void RecognitionConfig::set_encoding(::kaldi_serve::RecognitionConfig_AudioEncoding value) {
+inline void RecognitionConfig::_internal_set_encoding(::kaldi_serve::RecognitionConfig_AudioEncoding value) {
   
-  encoding_ = value;
+  _impl_.encoding_ = value;
+}
+inline void RecognitionConfig::set_encoding(::kaldi_serve::RecognitionConfig_AudioEncoding value) {
+  _internal_set_encoding(value);
   // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.encoding)
 }
 
 // int32 sample_rate_hertz = 2;
 inline void RecognitionConfig::clear_sample_rate_hertz() {
-  sample_rate_hertz_ = 0;
+  _impl_.sample_rate_hertz_ = 0;
 }
-inline ::google::protobuf::int32 RecognitionConfig::sample_rate_hertz() const {
+inline int32_t RecognitionConfig::_internal_sample_rate_hertz() const {
+  return _impl_.sample_rate_hertz_;
+}
+inline int32_t RecognitionConfig::sample_rate_hertz() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.sample_rate_hertz)
-  return sample_rate_hertz_;
+  return _internal_sample_rate_hertz();
 }
-inline void RecognitionConfig::set_sample_rate_hertz(::google::protobuf::int32 value) {
+inline void RecognitionConfig::_internal_set_sample_rate_hertz(int32_t value) {
   
-  sample_rate_hertz_ = value;
+  _impl_.sample_rate_hertz_ = value;
+}
+inline void RecognitionConfig::set_sample_rate_hertz(int32_t value) {
+  _internal_set_sample_rate_hertz(value);
   // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.sample_rate_hertz)
 }
 
 // string language_code = 3;
 inline void RecognitionConfig::clear_language_code() {
-  language_code_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.language_code_.ClearToEmpty();
 }
-inline const ::std::string& RecognitionConfig::language_code() const {
+inline const std::string& RecognitionConfig::language_code() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.language_code)
-  return language_code_.GetNoArena();
+  return _internal_language_code();
 }
-inline void RecognitionConfig::set_language_code(const ::std::string& value) {
-  
-  language_code_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RecognitionConfig::set_language_code(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.language_code_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.language_code)
 }
-#if LANG_CXX11
-inline void RecognitionConfig::set_language_code(::std::string&& value) {
-  
-  language_code_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kaldi_serve.RecognitionConfig.language_code)
+inline std::string* RecognitionConfig::mutable_language_code() {
+  std::string* _s = _internal_mutable_language_code();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognitionConfig.language_code)
+  return _s;
 }
-#endif
-inline void RecognitionConfig::set_language_code(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  language_code_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kaldi_serve.RecognitionConfig.language_code)
+inline const std::string& RecognitionConfig::_internal_language_code() const {
+  return _impl_.language_code_.Get();
 }
-inline void RecognitionConfig::set_language_code(const char* value, size_t size) {
+inline void RecognitionConfig::_internal_set_language_code(const std::string& value) {
   
-  language_code_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kaldi_serve.RecognitionConfig.language_code)
+  _impl_.language_code_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* RecognitionConfig::mutable_language_code() {
+inline std::string* RecognitionConfig::_internal_mutable_language_code() {
   
-  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognitionConfig.language_code)
-  return language_code_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.language_code_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* RecognitionConfig::release_language_code() {
+inline std::string* RecognitionConfig::release_language_code() {
   // @@protoc_insertion_point(field_release:kaldi_serve.RecognitionConfig.language_code)
-  
-  return language_code_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.language_code_.Release();
 }
-inline void RecognitionConfig::set_allocated_language_code(::std::string* language_code) {
+inline void RecognitionConfig::set_allocated_language_code(std::string* language_code) {
   if (language_code != nullptr) {
     
   } else {
     
   }
-  language_code_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), language_code);
+  _impl_.language_code_.SetAllocated(language_code, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.language_code_.IsDefault()) {
+    _impl_.language_code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognitionConfig.language_code)
 }
 
 // int32 max_alternatives = 4;
 inline void RecognitionConfig::clear_max_alternatives() {
-  max_alternatives_ = 0;
+  _impl_.max_alternatives_ = 0;
+}
+inline int32_t RecognitionConfig::_internal_max_alternatives() const {
+  return _impl_.max_alternatives_;
 }
-inline ::google::protobuf::int32 RecognitionConfig::max_alternatives() const {
+inline int32_t RecognitionConfig::max_alternatives() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.max_alternatives)
-  return max_alternatives_;
+  return _internal_max_alternatives();
 }
-inline void RecognitionConfig::set_max_alternatives(::google::protobuf::int32 value) {
+inline void RecognitionConfig::_internal_set_max_alternatives(int32_t value) {
   
-  max_alternatives_ = value;
+  _impl_.max_alternatives_ = value;
+}
+inline void RecognitionConfig::set_max_alternatives(int32_t value) {
+  _internal_set_max_alternatives(value);
   // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.max_alternatives)
 }
 
 // bool punctuation = 5;
 inline void RecognitionConfig::clear_punctuation() {
-  punctuation_ = false;
+  _impl_.punctuation_ = false;
+}
+inline bool RecognitionConfig::_internal_punctuation() const {
+  return _impl_.punctuation_;
 }
 inline bool RecognitionConfig::punctuation() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.punctuation)
-  return punctuation_;
+  return _internal_punctuation();
 }
-inline void RecognitionConfig::set_punctuation(bool value) {
+inline void RecognitionConfig::_internal_set_punctuation(bool value) {
   
-  punctuation_ = value;
+  _impl_.punctuation_ = value;
+}
+inline void RecognitionConfig::set_punctuation(bool value) {
+  _internal_set_punctuation(value);
   // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.punctuation)
 }
 
 // repeated .kaldi_serve.SpeechContext speech_contexts = 6;
+inline int RecognitionConfig::_internal_speech_contexts_size() const {
+  return _impl_.speech_contexts_.size();
+}
 inline int RecognitionConfig::speech_contexts_size() const {
-  return speech_contexts_.size();
+  return _internal_speech_contexts_size();
 }
 inline void RecognitionConfig::clear_speech_contexts() {
-  speech_contexts_.Clear();
+  _impl_.speech_contexts_.Clear();
 }
 inline ::kaldi_serve::SpeechContext* RecognitionConfig::mutable_speech_contexts(int index) {
   // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognitionConfig.speech_contexts)
-  return speech_contexts_.Mutable(index);
+  return _impl_.speech_contexts_.Mutable(index);
 }
-inline ::google::protobuf::RepeatedPtrField< ::kaldi_serve::SpeechContext >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechContext >*
 RecognitionConfig::mutable_speech_contexts() {
   // @@protoc_insertion_point(field_mutable_list:kaldi_serve.RecognitionConfig.speech_contexts)
-  return &speech_contexts_;
+  return &_impl_.speech_contexts_;
+}
+inline const ::kaldi_serve::SpeechContext& RecognitionConfig::_internal_speech_contexts(int index) const {
+  return _impl_.speech_contexts_.Get(index);
 }
 inline const ::kaldi_serve::SpeechContext& RecognitionConfig::speech_contexts(int index) const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.speech_contexts)
-  return speech_contexts_.Get(index);
+  return _internal_speech_contexts(index);
+}
+inline ::kaldi_serve::SpeechContext* RecognitionConfig::_internal_add_speech_contexts() {
+  return _impl_.speech_contexts_.Add();
 }
 inline ::kaldi_serve::SpeechContext* RecognitionConfig::add_speech_contexts() {
+  ::kaldi_serve::SpeechContext* _add = _internal_add_speech_contexts();
   // @@protoc_insertion_point(field_add:kaldi_serve.RecognitionConfig.speech_contexts)
-  return speech_contexts_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::kaldi_serve::SpeechContext >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechContext >&
 RecognitionConfig::speech_contexts() const {
   // @@protoc_insertion_point(field_list:kaldi_serve.RecognitionConfig.speech_contexts)
-  return speech_contexts_;
+  return _impl_.speech_contexts_;
 }
 
 // int32 audio_channel_count = 7;
 inline void RecognitionConfig::clear_audio_channel_count() {
-  audio_channel_count_ = 0;
+  _impl_.audio_channel_count_ = 0;
 }
-inline ::google::protobuf::int32 RecognitionConfig::audio_channel_count() const {
+inline int32_t RecognitionConfig::_internal_audio_channel_count() const {
+  return _impl_.audio_channel_count_;
+}
+inline int32_t RecognitionConfig::audio_channel_count() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.audio_channel_count)
-  return audio_channel_count_;
+  return _internal_audio_channel_count();
 }
-inline void RecognitionConfig::set_audio_channel_count(::google::protobuf::int32 value) {
+inline void RecognitionConfig::_internal_set_audio_channel_count(int32_t value) {
   
-  audio_channel_count_ = value;
+  _impl_.audio_channel_count_ = value;
+}
+inline void RecognitionConfig::set_audio_channel_count(int32_t value) {
+  _internal_set_audio_channel_count(value);
   // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.audio_channel_count)
 }
 
 // string model = 10;
 inline void RecognitionConfig::clear_model() {
-  model_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.model_.ClearToEmpty();
 }
-inline const ::std::string& RecognitionConfig::model() const {
+inline const std::string& RecognitionConfig::model() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.model)
-  return model_.GetNoArena();
+  return _internal_model();
 }
-inline void RecognitionConfig::set_model(const ::std::string& value) {
-  
-  model_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RecognitionConfig::set_model(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.model_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.model)
 }
-#if LANG_CXX11
-inline void RecognitionConfig::set_model(::std::string&& value) {
-  
-  model_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kaldi_serve.RecognitionConfig.model)
+inline std::string* RecognitionConfig::mutable_model() {
+  std::string* _s = _internal_mutable_model();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognitionConfig.model)
+  return _s;
 }
-#endif
-inline void RecognitionConfig::set_model(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  model_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kaldi_serve.RecognitionConfig.model)
+inline const std::string& RecognitionConfig::_internal_model() const {
+  return _impl_.model_.Get();
 }
-inline void RecognitionConfig::set_model(const char* value, size_t size) {
+inline void RecognitionConfig::_internal_set_model(const std::string& value) {
   
-  model_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kaldi_serve.RecognitionConfig.model)
+  _impl_.model_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* RecognitionConfig::mutable_model() {
+inline std::string* RecognitionConfig::_internal_mutable_model() {
   
-  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognitionConfig.model)
-  return model_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.model_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* RecognitionConfig::release_model() {
+inline std::string* RecognitionConfig::release_model() {
   // @@protoc_insertion_point(field_release:kaldi_serve.RecognitionConfig.model)
-  
-  return model_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.model_.Release();
 }
-inline void RecognitionConfig::set_allocated_model(::std::string* model) {
+inline void RecognitionConfig::set_allocated_model(std::string* model) {
   if (model != nullptr) {
     
   } else {
     
   }
-  model_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), model);
+  _impl_.model_.SetAllocated(model, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.model_.IsDefault()) {
+    _impl_.model_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognitionConfig.model)
 }
 
 // bool raw = 11;
 inline void RecognitionConfig::clear_raw() {
-  raw_ = false;
+  _impl_.raw_ = false;
+}
+inline bool RecognitionConfig::_internal_raw() const {
+  return _impl_.raw_;
 }
 inline bool RecognitionConfig::raw() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.raw)
-  return raw_;
+  return _internal_raw();
 }
-inline void RecognitionConfig::set_raw(bool value) {
+inline void RecognitionConfig::_internal_set_raw(bool value) {
   
-  raw_ = value;
+  _impl_.raw_ = value;
+}
+inline void RecognitionConfig::set_raw(bool value) {
+  _internal_set_raw(value);
   // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.raw)
 }
 
 // int32 data_bytes = 12;
 inline void RecognitionConfig::clear_data_bytes() {
-  data_bytes_ = 0;
+  _impl_.data_bytes_ = 0;
+}
+inline int32_t RecognitionConfig::_internal_data_bytes() const {
+  return _impl_.data_bytes_;
 }
-inline ::google::protobuf::int32 RecognitionConfig::data_bytes() const {
+inline int32_t RecognitionConfig::data_bytes() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.data_bytes)
-  return data_bytes_;
+  return _internal_data_bytes();
 }
-inline void RecognitionConfig::set_data_bytes(::google::protobuf::int32 value) {
+inline void RecognitionConfig::_internal_set_data_bytes(int32_t value) {
   
-  data_bytes_ = value;
+  _impl_.data_bytes_ = value;
+}
+inline void RecognitionConfig::set_data_bytes(int32_t value) {
+  _internal_set_data_bytes(value);
   // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.data_bytes)
 }
 
 // bool word_level = 13;
 inline void RecognitionConfig::clear_word_level() {
-  word_level_ = false;
+  _impl_.word_level_ = false;
+}
+inline bool RecognitionConfig::_internal_word_level() const {
+  return _impl_.word_level_;
 }
 inline bool RecognitionConfig::word_level() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.word_level)
-  return word_level_;
+  return _internal_word_level();
 }
-inline void RecognitionConfig::set_word_level(bool value) {
+inline void RecognitionConfig::_internal_set_word_level(bool value) {
   
-  word_level_ = value;
+  _impl_.word_level_ = value;
+}
+inline void RecognitionConfig::set_word_level(bool value) {
+  _internal_set_word_level(value);
   // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.word_level)
 }
 
+// float beam = 14;
+inline void RecognitionConfig::clear_beam() {
+  _impl_.beam_ = 0;
+}
+inline float RecognitionConfig::_internal_beam() const {
+  return _impl_.beam_;
+}
+inline float RecognitionConfig::beam() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.beam)
+  return _internal_beam();
+}
+inline void RecognitionConfig::_internal_set_beam(float value) {
+  
+  _impl_.beam_ = value;
+}
+inline void RecognitionConfig::set_beam(float value) {
+  _internal_set_beam(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.beam)
+}
+
+// int32 max_active = 15;
+inline void RecognitionConfig::clear_max_active() {
+  _impl_.max_active_ = 0;
+}
+inline int32_t RecognitionConfig::_internal_max_active() const {
+  return _impl_.max_active_;
+}
+inline int32_t RecognitionConfig::max_active() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.max_active)
+  return _internal_max_active();
+}
+inline void RecognitionConfig::_internal_set_max_active(int32_t value) {
+  
+  _impl_.max_active_ = value;
+}
+inline void RecognitionConfig::set_max_active(int32_t value) {
+  _internal_set_max_active(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.max_active)
+}
+
+// float lattice_beam = 16;
+inline void RecognitionConfig::clear_lattice_beam() {
+  _impl_.lattice_beam_ = 0;
+}
+inline float RecognitionConfig::_internal_lattice_beam() const {
+  return _impl_.lattice_beam_;
+}
+inline float RecognitionConfig::lattice_beam() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.lattice_beam)
+  return _internal_lattice_beam();
+}
+inline void RecognitionConfig::_internal_set_lattice_beam(float value) {
+  
+  _impl_.lattice_beam_ = value;
+}
+inline void RecognitionConfig::set_lattice_beam(float value) {
+  _internal_set_lattice_beam(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.lattice_beam)
+}
+
+// bool two_pass = 17;
+inline void RecognitionConfig::clear_two_pass() {
+  _impl_.two_pass_ = false;
+}
+inline bool RecognitionConfig::_internal_two_pass() const {
+  return _impl_.two_pass_;
+}
+inline bool RecognitionConfig::two_pass() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.two_pass)
+  return _internal_two_pass();
+}
+inline void RecognitionConfig::_internal_set_two_pass(bool value) {
+  
+  _impl_.two_pass_ = value;
+}
+inline void RecognitionConfig::set_two_pass(bool value) {
+  _internal_set_two_pass(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.two_pass)
+}
+
+// string graph = 18;
+inline void RecognitionConfig::clear_graph() {
+  _impl_.graph_.ClearToEmpty();
+}
+inline const std::string& RecognitionConfig::graph() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.graph)
+  return _internal_graph();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RecognitionConfig::set_graph(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.graph_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.graph)
+}
+inline std::string* RecognitionConfig::mutable_graph() {
+  std::string* _s = _internal_mutable_graph();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognitionConfig.graph)
+  return _s;
+}
+inline const std::string& RecognitionConfig::_internal_graph() const {
+  return _impl_.graph_.Get();
+}
+inline void RecognitionConfig::_internal_set_graph(const std::string& value) {
+  
+  _impl_.graph_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RecognitionConfig::_internal_mutable_graph() {
+  
+  return _impl_.graph_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RecognitionConfig::release_graph() {
+  // @@protoc_insertion_point(field_release:kaldi_serve.RecognitionConfig.graph)
+  return _impl_.graph_.Release();
+}
+inline void RecognitionConfig::set_allocated_graph(std::string* graph) {
+  if (graph != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.graph_.SetAllocated(graph, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.graph_.IsDefault()) {
+    _impl_.graph_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognitionConfig.graph)
+}
+
 // -------------------------------------------------------------------
 
 // RecognitionAudio
 
 // bytes content = 1;
-inline bool RecognitionAudio::has_content() const {
+inline bool RecognitionAudio::_internal_has_content() const {
   return audio_source_case() == kContent;
 }
+inline bool RecognitionAudio::has_content() const {
+  return _internal_has_content();
+}
 inline void RecognitionAudio::set_has_content() {
-  _oneof_case_[0] = kContent;
+  _impl_._oneof_case_[0] = kContent;
 }
 inline void RecognitionAudio::clear_content() {
-  if (has_content()) {
-    audio_source_.content_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (_internal_has_content()) {
+    _impl_.audio_source_.content_.Destroy();
     clear_has_audio_source();
   }
 }
-inline const ::std::string& RecognitionAudio::content() const {
+inline const std::string& RecognitionAudio::content() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionAudio.content)
-  if (has_content()) {
-    return audio_source_.content_.GetNoArena();
-  }
-  return *&::google::protobuf::internal::GetEmptyStringAlreadyInited();
+  return _internal_content();
 }
-inline void RecognitionAudio::set_content(const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionAudio.content)
-  if (!has_content()) {
+template <typename ArgT0, typename... ArgT>
+inline void RecognitionAudio::set_content(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_content()) {
     clear_audio_source();
     set_has_content();
-    audio_source_.content_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    _impl_.audio_source_.content_.InitDefault();
   }
-  audio_source_.content_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  _impl_.audio_source_.content_.SetBytes( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionAudio.content)
 }
-#if LANG_CXX11
-inline void RecognitionAudio::set_content(::std::string&& value) {
-  // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionAudio.content)
-  if (!has_content()) {
-    clear_audio_source();
-    set_has_content();
-    audio_source_.content_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  audio_source_.content_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kaldi_serve.RecognitionAudio.content)
+inline std::string* RecognitionAudio::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognitionAudio.content)
+  return _s;
 }
-#endif
-inline void RecognitionAudio::set_content(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  if (!has_content()) {
-    clear_audio_source();
-    set_has_content();
-    audio_source_.content_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& RecognitionAudio::_internal_content() const {
+  if (_internal_has_content()) {
+    return _impl_.audio_source_.content_.Get();
   }
-  audio_source_.content_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kaldi_serve.RecognitionAudio.content)
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
 }
-inline void RecognitionAudio::set_content(const void* value, size_t size) {
-  if (!has_content()) {
+inline void RecognitionAudio::_internal_set_content(const std::string& value) {
+  if (!_internal_has_content()) {
     clear_audio_source();
     set_has_content();
-    audio_source_.content_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    _impl_.audio_source_.content_.InitDefault();
   }
-  audio_source_.content_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kaldi_serve.RecognitionAudio.content)
+  _impl_.audio_source_.content_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* RecognitionAudio::mutable_content() {
-  if (!has_content()) {
+inline std::string* RecognitionAudio::_internal_mutable_content() {
+  if (!_internal_has_content()) {
     clear_audio_source();
     set_has_content();
-    audio_source_.content_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    _impl_.audio_source_.content_.InitDefault();
   }
-  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognitionAudio.content)
-  return audio_source_.content_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.audio_source_.content_.Mutable(      GetArenaForAllocation());
 }
-inline ::std::string* RecognitionAudio::release_content() {
+inline std::string* RecognitionAudio::release_content() {
   // @@protoc_insertion_point(field_release:kaldi_serve.RecognitionAudio.content)
-  if (has_content()) {
+  if (_internal_has_content()) {
     clear_has_audio_source();
-    return audio_source_.content_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    return _impl_.audio_source_.content_.Release();
   } else {
     return nullptr;
   }
 }
-inline void RecognitionAudio::set_allocated_content(::std::string* content) {
+inline void RecognitionAudio::set_allocated_content(std::string* content) {
   if (has_audio_source()) {
     clear_audio_source();
   }
   if (content != nullptr) {
     set_has_content();
-    audio_source_.content_.UnsafeSetDefault(content);
+    _impl_.audio_source_.content_.InitAllocated(content, GetArenaForAllocation());
   }
   // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognitionAudio.content)
 }
 
 // string uri = 2;
-inline bool RecognitionAudio::has_uri() const {
+inline bool RecognitionAudio::_internal_has_uri() const {
   return audio_source_case() == kUri;
 }
+inline bool RecognitionAudio::has_uri() const {
+  return _internal_has_uri();
+}
 inline void RecognitionAudio::set_has_uri() {
-  _oneof_case_[0] = kUri;
+  _impl_._oneof_case_[0] = kUri;
 }
 inline void RecognitionAudio::clear_uri() {
-  if (has_uri()) {
-    audio_source_.uri_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (_internal_has_uri()) {
+    _impl_.audio_source_.uri_.Destroy();
     clear_has_audio_source();
   }
 }
-inline const ::std::string& RecognitionAudio::uri() const {
+inline const std::string& RecognitionAudio::uri() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionAudio.uri)
-  if (has_uri()) {
-    return audio_source_.uri_.GetNoArena();
-  }
-  return *&::google::protobuf::internal::GetEmptyStringAlreadyInited();
+  return _internal_uri();
 }
-inline void RecognitionAudio::set_uri(const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionAudio.uri)
-  if (!has_uri()) {
+template <typename ArgT0, typename... ArgT>
+inline void RecognitionAudio::set_uri(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_uri()) {
     clear_audio_source();
     set_has_uri();
-    audio_source_.uri_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    _impl_.audio_source_.uri_.InitDefault();
   }
-  audio_source_.uri_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  _impl_.audio_source_.uri_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionAudio.uri)
 }
-#if LANG_CXX11
-inline void RecognitionAudio::set_uri(::std::string&& value) {
-  // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionAudio.uri)
-  if (!has_uri()) {
-    clear_audio_source();
-    set_has_uri();
-    audio_source_.uri_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  audio_source_.uri_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kaldi_serve.RecognitionAudio.uri)
+inline std::string* RecognitionAudio::mutable_uri() {
+  std::string* _s = _internal_mutable_uri();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognitionAudio.uri)
+  return _s;
 }
-#endif
-inline void RecognitionAudio::set_uri(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  if (!has_uri()) {
-    clear_audio_source();
-    set_has_uri();
-    audio_source_.uri_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& RecognitionAudio::_internal_uri() const {
+  if (_internal_has_uri()) {
+    return _impl_.audio_source_.uri_.Get();
   }
-  audio_source_.uri_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kaldi_serve.RecognitionAudio.uri)
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
 }
-inline void RecognitionAudio::set_uri(const char* value, size_t size) {
-  if (!has_uri()) {
+inline void RecognitionAudio::_internal_set_uri(const std::string& value) {
+  if (!_internal_has_uri()) {
     clear_audio_source();
     set_has_uri();
-    audio_source_.uri_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    _impl_.audio_source_.uri_.InitDefault();
   }
-  audio_source_.uri_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kaldi_serve.RecognitionAudio.uri)
+  _impl_.audio_source_.uri_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* RecognitionAudio::mutable_uri() {
-  if (!has_uri()) {
+inline std::string* RecognitionAudio::_internal_mutable_uri() {
+  if (!_internal_has_uri()) {
     clear_audio_source();
     set_has_uri();
-    audio_source_.uri_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    _impl_.audio_source_.uri_.InitDefault();
   }
-  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognitionAudio.uri)
-  return audio_source_.uri_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.audio_source_.uri_.Mutable(      GetArenaForAllocation());
 }
-inline ::std::string* RecognitionAudio::release_uri() {
+inline std::string* RecognitionAudio::release_uri() {
   // @@protoc_insertion_point(field_release:kaldi_serve.RecognitionAudio.uri)
-  if (has_uri()) {
+  if (_internal_has_uri()) {
     clear_has_audio_source();
-    return audio_source_.uri_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    return _impl_.audio_source_.uri_.Release();
   } else {
     return nullptr;
   }
 }
-inline void RecognitionAudio::set_allocated_uri(::std::string* uri) {
+inline void RecognitionAudio::set_allocated_uri(std::string* uri) {
   if (has_audio_source()) {
     clear_audio_source();
   }
   if (uri != nullptr) {
     set_has_uri();
-    audio_source_.uri_.UnsafeSetDefault(uri);
+    _impl_.audio_source_.uri_.InitAllocated(uri, GetArenaForAllocation());
   }
   // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognitionAudio.uri)
 }
@@ -1960,43 +3374,53 @@ inline bool RecognitionAudio::has_audio_source() const {
   return audio_source_case() != AUDIO_SOURCE_NOT_SET;
 }
 inline void RecognitionAudio::clear_has_audio_source() {
-  _oneof_case_[0] = AUDIO_SOURCE_NOT_SET;
+  _impl_._oneof_case_[0] = AUDIO_SOURCE_NOT_SET;
 }
 inline RecognitionAudio::AudioSourceCase RecognitionAudio::audio_source_case() const {
-  return RecognitionAudio::AudioSourceCase(_oneof_case_[0]);
+  return RecognitionAudio::AudioSourceCase(_impl_._oneof_case_[0]);
 }
 // -------------------------------------------------------------------
 
 // SpeechRecognitionResult
 
 // repeated .kaldi_serve.SpeechRecognitionAlternative alternatives = 1;
+inline int SpeechRecognitionResult::_internal_alternatives_size() const {
+  return _impl_.alternatives_.size();
+}
 inline int SpeechRecognitionResult::alternatives_size() const {
-  return alternatives_.size();
+  return _internal_alternatives_size();
 }
 inline void SpeechRecognitionResult::clear_alternatives() {
-  alternatives_.Clear();
+  _impl_.alternatives_.Clear();
 }
 inline ::kaldi_serve::SpeechRecognitionAlternative* SpeechRecognitionResult::mutable_alternatives(int index) {
   // @@protoc_insertion_point(field_mutable:kaldi_serve.SpeechRecognitionResult.alternatives)
-  return alternatives_.Mutable(index);
+  return _impl_.alternatives_.Mutable(index);
 }
-inline ::google::protobuf::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionAlternative >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionAlternative >*
 SpeechRecognitionResult::mutable_alternatives() {
   // @@protoc_insertion_point(field_mutable_list:kaldi_serve.SpeechRecognitionResult.alternatives)
-  return &alternatives_;
+  return &_impl_.alternatives_;
+}
+inline const ::kaldi_serve::SpeechRecognitionAlternative& SpeechRecognitionResult::_internal_alternatives(int index) const {
+  return _impl_.alternatives_.Get(index);
 }
 inline const ::kaldi_serve::SpeechRecognitionAlternative& SpeechRecognitionResult::alternatives(int index) const {
   // @@protoc_insertion_point(field_get:kaldi_serve.SpeechRecognitionResult.alternatives)
-  return alternatives_.Get(index);
+  return _internal_alternatives(index);
+}
+inline ::kaldi_serve::SpeechRecognitionAlternative* SpeechRecognitionResult::_internal_add_alternatives() {
+  return _impl_.alternatives_.Add();
 }
 inline ::kaldi_serve::SpeechRecognitionAlternative* SpeechRecognitionResult::add_alternatives() {
+  ::kaldi_serve::SpeechRecognitionAlternative* _add = _internal_add_alternatives();
   // @@protoc_insertion_point(field_add:kaldi_serve.SpeechRecognitionResult.alternatives)
-  return alternatives_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionAlternative >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionAlternative >&
 SpeechRecognitionResult::alternatives() const {
   // @@protoc_insertion_point(field_list:kaldi_serve.SpeechRecognitionResult.alternatives)
-  return alternatives_;
+  return _impl_.alternatives_;
 }
 
 // -------------------------------------------------------------------
@@ -2005,127 +3429,152 @@ SpeechRecognitionResult::alternatives() const {
 
 // string transcript = 1;
 inline void SpeechRecognitionAlternative::clear_transcript() {
-  transcript_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.transcript_.ClearToEmpty();
 }
-inline const ::std::string& SpeechRecognitionAlternative::transcript() const {
+inline const std::string& SpeechRecognitionAlternative::transcript() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.SpeechRecognitionAlternative.transcript)
-  return transcript_.GetNoArena();
+  return _internal_transcript();
 }
-inline void SpeechRecognitionAlternative::set_transcript(const ::std::string& value) {
-  
-  transcript_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SpeechRecognitionAlternative::set_transcript(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.transcript_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kaldi_serve.SpeechRecognitionAlternative.transcript)
 }
-#if LANG_CXX11
-inline void SpeechRecognitionAlternative::set_transcript(::std::string&& value) {
-  
-  transcript_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kaldi_serve.SpeechRecognitionAlternative.transcript)
+inline std::string* SpeechRecognitionAlternative::mutable_transcript() {
+  std::string* _s = _internal_mutable_transcript();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.SpeechRecognitionAlternative.transcript)
+  return _s;
 }
-#endif
-inline void SpeechRecognitionAlternative::set_transcript(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  transcript_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kaldi_serve.SpeechRecognitionAlternative.transcript)
+inline const std::string& SpeechRecognitionAlternative::_internal_transcript() const {
+  return _impl_.transcript_.Get();
 }
-inline void SpeechRecognitionAlternative::set_transcript(const char* value, size_t size) {
+inline void SpeechRecognitionAlternative::_internal_set_transcript(const std::string& value) {
   
-  transcript_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kaldi_serve.SpeechRecognitionAlternative.transcript)
+  _impl_.transcript_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* SpeechRecognitionAlternative::mutable_transcript() {
+inline std::string* SpeechRecognitionAlternative::_internal_mutable_transcript() {
   
-  // @@protoc_insertion_point(field_mutable:kaldi_serve.SpeechRecognitionAlternative.transcript)
-  return transcript_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.transcript_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* SpeechRecognitionAlternative::release_transcript() {
+inline std::string* SpeechRecognitionAlternative::release_transcript() {
   // @@protoc_insertion_point(field_release:kaldi_serve.SpeechRecognitionAlternative.transcript)
-  
-  return transcript_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.transcript_.Release();
 }
-inline void SpeechRecognitionAlternative::set_allocated_transcript(::std::string* transcript) {
+inline void SpeechRecognitionAlternative::set_allocated_transcript(std::string* transcript) {
   if (transcript != nullptr) {
     
   } else {
     
   }
-  transcript_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), transcript);
+  _impl_.transcript_.SetAllocated(transcript, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.transcript_.IsDefault()) {
+    _impl_.transcript_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:kaldi_serve.SpeechRecognitionAlternative.transcript)
 }
 
 // float confidence = 2;
 inline void SpeechRecognitionAlternative::clear_confidence() {
-  confidence_ = 0;
+  _impl_.confidence_ = 0;
+}
+inline float SpeechRecognitionAlternative::_internal_confidence() const {
+  return _impl_.confidence_;
 }
 inline float SpeechRecognitionAlternative::confidence() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.SpeechRecognitionAlternative.confidence)
-  return confidence_;
+  return _internal_confidence();
 }
-inline void SpeechRecognitionAlternative::set_confidence(float value) {
+inline void SpeechRecognitionAlternative::_internal_set_confidence(float value) {
   
-  confidence_ = value;
+  _impl_.confidence_ = value;
+}
+inline void SpeechRecognitionAlternative::set_confidence(float value) {
+  _internal_set_confidence(value);
   // @@protoc_insertion_point(field_set:kaldi_serve.SpeechRecognitionAlternative.confidence)
 }
 
 // float am_score = 3;
 inline void SpeechRecognitionAlternative::clear_am_score() {
-  am_score_ = 0;
+  _impl_.am_score_ = 0;
+}
+inline float SpeechRecognitionAlternative::_internal_am_score() const {
+  return _impl_.am_score_;
 }
 inline float SpeechRecognitionAlternative::am_score() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.SpeechRecognitionAlternative.am_score)
-  return am_score_;
+  return _internal_am_score();
 }
-inline void SpeechRecognitionAlternative::set_am_score(float value) {
+inline void SpeechRecognitionAlternative::_internal_set_am_score(float value) {
   
-  am_score_ = value;
+  _impl_.am_score_ = value;
+}
+inline void SpeechRecognitionAlternative::set_am_score(float value) {
+  _internal_set_am_score(value);
   // @@protoc_insertion_point(field_set:kaldi_serve.SpeechRecognitionAlternative.am_score)
 }
 
 // float lm_score = 4;
 inline void SpeechRecognitionAlternative::clear_lm_score() {
-  lm_score_ = 0;
+  _impl_.lm_score_ = 0;
+}
+inline float SpeechRecognitionAlternative::_internal_lm_score() const {
+  return _impl_.lm_score_;
 }
 inline float SpeechRecognitionAlternative::lm_score() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.SpeechRecognitionAlternative.lm_score)
-  return lm_score_;
+  return _internal_lm_score();
 }
-inline void SpeechRecognitionAlternative::set_lm_score(float value) {
+inline void SpeechRecognitionAlternative::_internal_set_lm_score(float value) {
   
-  lm_score_ = value;
+  _impl_.lm_score_ = value;
+}
+inline void SpeechRecognitionAlternative::set_lm_score(float value) {
+  _internal_set_lm_score(value);
   // @@protoc_insertion_point(field_set:kaldi_serve.SpeechRecognitionAlternative.lm_score)
 }
 
 // repeated .kaldi_serve.Word words = 5;
+inline int SpeechRecognitionAlternative::_internal_words_size() const {
+  return _impl_.words_.size();
+}
 inline int SpeechRecognitionAlternative::words_size() const {
-  return words_.size();
+  return _internal_words_size();
 }
 inline void SpeechRecognitionAlternative::clear_words() {
-  words_.Clear();
+  _impl_.words_.Clear();
 }
 inline ::kaldi_serve::Word* SpeechRecognitionAlternative::mutable_words(int index) {
   // @@protoc_insertion_point(field_mutable:kaldi_serve.SpeechRecognitionAlternative.words)
-  return words_.Mutable(index);
+  return _impl_.words_.Mutable(index);
 }
-inline ::google::protobuf::RepeatedPtrField< ::kaldi_serve::Word >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::Word >*
 SpeechRecognitionAlternative::mutable_words() {
   // @@protoc_insertion_point(field_mutable_list:kaldi_serve.SpeechRecognitionAlternative.words)
-  return &words_;
+  return &_impl_.words_;
+}
+inline const ::kaldi_serve::Word& SpeechRecognitionAlternative::_internal_words(int index) const {
+  return _impl_.words_.Get(index);
 }
 inline const ::kaldi_serve::Word& SpeechRecognitionAlternative::words(int index) const {
   // @@protoc_insertion_point(field_get:kaldi_serve.SpeechRecognitionAlternative.words)
-  return words_.Get(index);
+  return _internal_words(index);
+}
+inline ::kaldi_serve::Word* SpeechRecognitionAlternative::_internal_add_words() {
+  return _impl_.words_.Add();
 }
 inline ::kaldi_serve::Word* SpeechRecognitionAlternative::add_words() {
+  ::kaldi_serve::Word* _add = _internal_add_words();
   // @@protoc_insertion_point(field_add:kaldi_serve.SpeechRecognitionAlternative.words)
-  return words_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::kaldi_serve::Word >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::Word >&
 SpeechRecognitionAlternative::words() const {
   // @@protoc_insertion_point(field_list:kaldi_serve.SpeechRecognitionAlternative.words)
-  return words_;
+  return _impl_.words_;
 }
 
 // -------------------------------------------------------------------
@@ -2134,96 +3583,111 @@ SpeechRecognitionAlternative::words() const {
 
 // float start_time = 1;
 inline void Word::clear_start_time() {
-  start_time_ = 0;
+  _impl_.start_time_ = 0;
+}
+inline float Word::_internal_start_time() const {
+  return _impl_.start_time_;
 }
 inline float Word::start_time() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.Word.start_time)
-  return start_time_;
+  return _internal_start_time();
 }
-inline void Word::set_start_time(float value) {
+inline void Word::_internal_set_start_time(float value) {
   
-  start_time_ = value;
+  _impl_.start_time_ = value;
+}
+inline void Word::set_start_time(float value) {
+  _internal_set_start_time(value);
   // @@protoc_insertion_point(field_set:kaldi_serve.Word.start_time)
 }
 
 // float end_time = 2;
 inline void Word::clear_end_time() {
-  end_time_ = 0;
+  _impl_.end_time_ = 0;
+}
+inline float Word::_internal_end_time() const {
+  return _impl_.end_time_;
 }
 inline float Word::end_time() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.Word.end_time)
-  return end_time_;
+  return _internal_end_time();
 }
-inline void Word::set_end_time(float value) {
+inline void Word::_internal_set_end_time(float value) {
   
-  end_time_ = value;
+  _impl_.end_time_ = value;
+}
+inline void Word::set_end_time(float value) {
+  _internal_set_end_time(value);
   // @@protoc_insertion_point(field_set:kaldi_serve.Word.end_time)
 }
 
 // string word = 3;
 inline void Word::clear_word() {
-  word_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.word_.ClearToEmpty();
 }
-inline const ::std::string& Word::word() const {
+inline const std::string& Word::word() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.Word.word)
-  return word_.GetNoArena();
+  return _internal_word();
 }
-inline void Word::set_word(const ::std::string& value) {
-  
-  word_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Word::set_word(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.word_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kaldi_serve.Word.word)
 }
-#if LANG_CXX11
-inline void Word::set_word(::std::string&& value) {
-  
-  word_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kaldi_serve.Word.word)
+inline std::string* Word::mutable_word() {
+  std::string* _s = _internal_mutable_word();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.Word.word)
+  return _s;
 }
-#endif
-inline void Word::set_word(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  word_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kaldi_serve.Word.word)
+inline const std::string& Word::_internal_word() const {
+  return _impl_.word_.Get();
 }
-inline void Word::set_word(const char* value, size_t size) {
+inline void Word::_internal_set_word(const std::string& value) {
   
-  word_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kaldi_serve.Word.word)
+  _impl_.word_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Word::mutable_word() {
+inline std::string* Word::_internal_mutable_word() {
   
-  // @@protoc_insertion_point(field_mutable:kaldi_serve.Word.word)
-  return word_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.word_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Word::release_word() {
+inline std::string* Word::release_word() {
   // @@protoc_insertion_point(field_release:kaldi_serve.Word.word)
-  
-  return word_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.word_.Release();
 }
-inline void Word::set_allocated_word(::std::string* word) {
+inline void Word::set_allocated_word(std::string* word) {
   if (word != nullptr) {
     
   } else {
     
   }
-  word_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), word);
+  _impl_.word_.SetAllocated(word, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.word_.IsDefault()) {
+    _impl_.word_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:kaldi_serve.Word.word)
 }
 
 // float confidence = 4;
 inline void Word::clear_confidence() {
-  confidence_ = 0;
+  _impl_.confidence_ = 0;
+}
+inline float Word::_internal_confidence() const {
+  return _impl_.confidence_;
 }
 inline float Word::confidence() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.Word.confidence)
-  return confidence_;
+  return _internal_confidence();
 }
-inline void Word::set_confidence(float value) {
+inline void Word::_internal_set_confidence(float value) {
   
-  confidence_ = value;
+  _impl_.confidence_ = value;
+}
+inline void Word::set_confidence(float value) {
+  _internal_set_confidence(value);
   // @@protoc_insertion_point(field_set:kaldi_serve.Word.confidence)
 }
 
@@ -2232,124 +3696,127 @@ inline void Word::set_confidence(float value) {
 // SpeechContext
 
 // repeated string phrases = 1;
+inline int SpeechContext::_internal_phrases_size() const {
+  return _impl_.phrases_.size();
+}
 inline int SpeechContext::phrases_size() const {
-  return phrases_.size();
+  return _internal_phrases_size();
 }
 inline void SpeechContext::clear_phrases() {
-  phrases_.Clear();
+  _impl_.phrases_.Clear();
+}
+inline std::string* SpeechContext::add_phrases() {
+  std::string* _s = _internal_add_phrases();
+  // @@protoc_insertion_point(field_add_mutable:kaldi_serve.SpeechContext.phrases)
+  return _s;
+}
+inline const std::string& SpeechContext::_internal_phrases(int index) const {
+  return _impl_.phrases_.Get(index);
 }
-inline const ::std::string& SpeechContext::phrases(int index) const {
+inline const std::string& SpeechContext::phrases(int index) const {
   // @@protoc_insertion_point(field_get:kaldi_serve.SpeechContext.phrases)
-  return phrases_.Get(index);
+  return _internal_phrases(index);
 }
-inline ::std::string* SpeechContext::mutable_phrases(int index) {
+inline std::string* SpeechContext::mutable_phrases(int index) {
   // @@protoc_insertion_point(field_mutable:kaldi_serve.SpeechContext.phrases)
-  return phrases_.Mutable(index);
+  return _impl_.phrases_.Mutable(index);
 }
-inline void SpeechContext::set_phrases(int index, const ::std::string& value) {
+inline void SpeechContext::set_phrases(int index, const std::string& value) {
+  _impl_.phrases_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:kaldi_serve.SpeechContext.phrases)
-  phrases_.Mutable(index)->assign(value);
 }
-#if LANG_CXX11
-inline void SpeechContext::set_phrases(int index, ::std::string&& value) {
+inline void SpeechContext::set_phrases(int index, std::string&& value) {
+  _impl_.phrases_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:kaldi_serve.SpeechContext.phrases)
-  phrases_.Mutable(index)->assign(std::move(value));
 }
-#endif
 inline void SpeechContext::set_phrases(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  phrases_.Mutable(index)->assign(value);
+  _impl_.phrases_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:kaldi_serve.SpeechContext.phrases)
 }
 inline void SpeechContext::set_phrases(int index, const char* value, size_t size) {
-  phrases_.Mutable(index)->assign(
+  _impl_.phrases_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:kaldi_serve.SpeechContext.phrases)
 }
-inline ::std::string* SpeechContext::add_phrases() {
-  // @@protoc_insertion_point(field_add_mutable:kaldi_serve.SpeechContext.phrases)
-  return phrases_.Add();
+inline std::string* SpeechContext::_internal_add_phrases() {
+  return _impl_.phrases_.Add();
 }
-inline void SpeechContext::add_phrases(const ::std::string& value) {
-  phrases_.Add()->assign(value);
+inline void SpeechContext::add_phrases(const std::string& value) {
+  _impl_.phrases_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:kaldi_serve.SpeechContext.phrases)
 }
-#if LANG_CXX11
-inline void SpeechContext::add_phrases(::std::string&& value) {
-  phrases_.Add(std::move(value));
+inline void SpeechContext::add_phrases(std::string&& value) {
+  _impl_.phrases_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:kaldi_serve.SpeechContext.phrases)
 }
-#endif
 inline void SpeechContext::add_phrases(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  phrases_.Add()->assign(value);
+  _impl_.phrases_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:kaldi_serve.SpeechContext.phrases)
 }
 inline void SpeechContext::add_phrases(const char* value, size_t size) {
-  phrases_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.phrases_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:kaldi_serve.SpeechContext.phrases)
 }
-inline const ::google::protobuf::RepeatedPtrField<::std::string>&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 SpeechContext::phrases() const {
   // @@protoc_insertion_point(field_list:kaldi_serve.SpeechContext.phrases)
-  return phrases_;
+  return _impl_.phrases_;
 }
-inline ::google::protobuf::RepeatedPtrField<::std::string>*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 SpeechContext::mutable_phrases() {
   // @@protoc_insertion_point(field_mutable_list:kaldi_serve.SpeechContext.phrases)
-  return &phrases_;
+  return &_impl_.phrases_;
 }
 
 // string type = 2;
 inline void SpeechContext::clear_type() {
-  type_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.type_.ClearToEmpty();
 }
-inline const ::std::string& SpeechContext::type() const {
+inline const std::string& SpeechContext::type() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.SpeechContext.type)
-  return type_.GetNoArena();
+  return _internal_type();
 }
-inline void SpeechContext::set_type(const ::std::string& value) {
-  
-  type_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SpeechContext::set_type(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kaldi_serve.SpeechContext.type)
 }
-#if LANG_CXX11
-inline void SpeechContext::set_type(::std::string&& value) {
-  
-  type_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kaldi_serve.SpeechContext.type)
+inline std::string* SpeechContext::mutable_type() {
+  std::string* _s = _internal_mutable_type();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.SpeechContext.type)
+  return _s;
 }
-#endif
-inline void SpeechContext::set_type(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  type_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kaldi_serve.SpeechContext.type)
+inline const std::string& SpeechContext::_internal_type() const {
+  return _impl_.type_.Get();
 }
-inline void SpeechContext::set_type(const char* value, size_t size) {
+inline void SpeechContext::_internal_set_type(const std::string& value) {
   
-  type_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kaldi_serve.SpeechContext.type)
+  _impl_.type_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* SpeechContext::mutable_type() {
+inline std::string* SpeechContext::_internal_mutable_type() {
   
-  // @@protoc_insertion_point(field_mutable:kaldi_serve.SpeechContext.type)
-  return type_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.type_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* SpeechContext::release_type() {
+inline std::string* SpeechContext::release_type() {
   // @@protoc_insertion_point(field_release:kaldi_serve.SpeechContext.type)
-  
-  return type_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.type_.Release();
 }
-inline void SpeechContext::set_allocated_type(::std::string* type) {
+inline void SpeechContext::set_allocated_type(std::string* type) {
   if (type != nullptr) {
     
   } else {
     
   }
-  type_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), type);
+  _impl_.type_.SetAllocated(type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:kaldi_serve.SpeechContext.type)
 }
 
@@ -2370,13 +3837,20 @@ inline void SpeechContext::set_allocated_type(::std::string* type) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace kaldi_serve
 
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
 template <> struct is_proto_enum< ::kaldi_serve::RecognitionConfig_AudioEncoding> : ::std::true_type {};
 template <>
@@ -2384,10 +3858,9 @@ inline const EnumDescriptor* GetEnumDescriptor< ::kaldi_serve::RecognitionConfig
   return ::kaldi_serve::RecognitionConfig_AudioEncoding_descriptor();
 }
 
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
-#endif  // PROTOBUF_INCLUDED_kaldi_5fserve_2eproto
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_kaldi_5fserve_2eproto
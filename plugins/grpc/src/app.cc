@@ -29,6 +29,10 @@ int main(int argc, char *argv[]) {
       ->required()
       ->check(CLI::ExistingFile);
 
+    std::size_t memory_budget_mb = 0;
+    app.add_option("-m,--memory-budget", memory_budget_mb,
+                   "Memory budget (in MB) for loaded models, idle lazy models are evicted above it (0 for no limit)");
+
     app.add_flag("-d,--debug", DEBUG, "Flag to enable debug mode");
 
     app.add_flag_callback("-v,--version", print_version, "Show program version and exit");
@@ -45,10 +49,11 @@ int main(int argc, char *argv[]) {
 
     std::cout << ":: Loading " << model_specs.size() << " models" << ENDL;
     for (auto const &model_spec : model_specs) {
-        std::cout << "::   - " << model_spec.name + " (" + model_spec.language_code + ")" << ENDL;
+        std::cout << "::   - " << model_spec.name + " (" + model_spec.language_code + ")"
+                  << (model_spec.lazy ? " [lazy]" : "") << ENDL;
     }
 
-    run_server(model_specs);
+    run_server(model_spec_toml, model_specs, memory_budget_mb);
 
     return 0;
 }
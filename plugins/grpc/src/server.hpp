@@ -2,15 +2,29 @@
 #pragma once
 
 // stl includes
+#include <algorithm>
 #include <iostream>
 #include <unordered_map>
 #include <memory>
 #include <string>
 #include <exception>
 #include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <signal.h>
+#include <pthread.h>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 
 // lib includes
+#include <kaldiserve/bundle.hpp>
 #include <kaldiserve/decoder.hpp>
+#include <kaldiserve/metrics.hpp>
+#include <kaldiserve/model.hpp>
+#include <kaldiserve/utils.hpp>
 
 // kaldi includes
 #include <base/kaldi-error.h>
@@ -59,6 +73,164 @@ void add_alternatives_to_response(const utterance_results_t &results,
 }
 
 
+void add_search_params_to_response(const kaldi::LatticeFasterDecoderConfig &search_config,
+                                   kaldi_serve::RecognizeResponse *response) noexcept {
+    kaldi_serve::SearchParams *search_params = response->mutable_search_params();
+    search_params->set_beam(search_config.beam);
+    search_params->set_max_active(search_config.max_active);
+    search_params->set_lattice_beam(search_config.lattice_beam);
+}
+
+
+// StreamWatchdog ::
+// Cancels streaming sessions waiting for a chunk that stalled (no chunk within
+// the model's `stream_idle_timeout_ms`) or ran longer than the model's
+// `max_stream_secs`. Handlers blocked on a stalled client then wake up and go
+// through the cancellation path, which returns their decoder to the pool.
+// Time spent decoding or writing responses never counts as a stall.
+class StreamWatchdog final {
+
+  public:
+    // A stream watched until it ends or goes out of scope (if its model has limits).
+    class Session final {
+
+      public:
+        Session(StreamWatchdog &watchdog, grpc::ServerContext *const context, const ModelSpec &model_spec);
+
+        Session(const Session &) = delete;
+        Session &operator=(const Session &) = delete;
+
+        ~Session();
+
+        // brackets a blocking read of the next chunk (only reads time out)
+        void begin_read();
+        void end_read();
+
+        // stops watching, e.g. once all chunks are read
+        void end();
+
+      private:
+        friend class StreamWatchdog;
+
+        StreamWatchdog &watchdog_;
+        grpc::ServerContext *const context_;
+        const ModelSpec &model_spec_;
+        bool watched_;
+        bool reading_;
+        std::chrono::steady_clock::time_point start_time_, read_start_time_;
+    };
+
+    StreamWatchdog();
+
+    StreamWatchdog(const StreamWatchdog &) = delete;
+    StreamWatchdog &operator=(const StreamWatchdog &) = delete;
+
+    ~StreamWatchdog();
+
+  private:
+    // cancels the sessions over their limits
+    void check_();
+
+    std::unordered_set<Session *> sessions_;
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    bool stopped_;
+    std::thread thread_;
+};
+
+StreamWatchdog::Session::Session(StreamWatchdog &watchdog,
+                                 grpc::ServerContext *const context,
+                                 const ModelSpec &model_spec)
+    : watchdog_(watchdog), context_(context), model_spec_(model_spec),
+      watched_(model_spec.stream_idle_timeout_ms > 0 || model_spec.max_stream_secs > 0), reading_(false),
+      start_time_(std::chrono::steady_clock::now()), read_start_time_(start_time_) {
+    if (!watched_) return;
+
+    std::lock_guard<std::mutex> lock(watchdog_.mutex_);
+    watchdog_.sessions_.insert(this);
+}
+
+StreamWatchdog::Session::~Session() {
+    end();
+}
+
+void StreamWatchdog::Session::begin_read() {
+    if (!watched_) return;
+
+    std::lock_guard<std::mutex> lock(watchdog_.mutex_);
+    reading_ = true;
+    read_start_time_ = std::chrono::steady_clock::now();
+}
+
+void StreamWatchdog::Session::end_read() {
+    if (!watched_) return;
+
+    std::lock_guard<std::mutex> lock(watchdog_.mutex_);
+    reading_ = false;
+}
+
+void StreamWatchdog::Session::end() {
+    if (!watched_) return;
+
+    std::lock_guard<std::mutex> lock(watchdog_.mutex_);
+    watchdog_.sessions_.erase(this);
+    watched_ = false;
+}
+
+StreamWatchdog::StreamWatchdog() : stopped_(false) {
+    thread_ = std::thread([this]() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!stopped_) {
+            // (timeouts fire up to a check interval late)
+            cond_.wait_for(lock, std::chrono::milliseconds(100));
+            check_();
+        }
+    });
+}
+
+StreamWatchdog::~StreamWatchdog() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+    }
+    cond_.notify_one();
+    thread_.join();
+}
+
+void StreamWatchdog::check_() {
+    const auto now = std::chrono::steady_clock::now();
+
+    for (auto it = sessions_.begin(); it != sessions_.end();) {
+        Session *session = *it;
+        const ModelSpec &model_spec = session->model_spec_;
+
+        // busy decoding or writing responses
+        if (!session->reading_) {
+            ++it;
+            continue;
+        }
+
+        const bool idle = model_spec.stream_idle_timeout_ms > 0 &&
+                          now - session->read_start_time_ > std::chrono::milliseconds(model_spec.stream_idle_timeout_ms);
+        const bool overlong = model_spec.max_stream_secs > 0 &&
+                              now - session->start_time_ > std::chrono::seconds(model_spec.max_stream_secs);
+
+        if (!idle && !overlong) {
+            ++it;
+            continue;
+        }
+
+        std::cout << ":: Cancelling " << (idle ? "idle" : "overlong") << " stream on model "
+                  << model_spec.name << " (" << model_spec.language_code << ")" << ENDL;
+        metrics().increment(model_metric(idle ? "stream_idle_timeouts" : "stream_duration_timeouts", model_spec));
+
+        // cancelled once, the handler unwatches it on its way out
+        session->context_->TryCancel();
+        it = sessions_.erase(it);
+    }
+}
+
+
 // KaldiServeImpl ::
 // Defines the core server logic and request/response handlers.
 // Keeps `Decoder` instances cached in a thread-safe
@@ -67,14 +239,95 @@ void add_alternatives_to_response(const utterance_results_t &results,
 class KaldiServeImpl final : public kaldi_serve::KaldiServe::Service {
 
   private:
-    // Map of Thread-safe Decoder MPMC Queues for diff languages/models
-    std::unordered_map<model_id_t, std::unique_ptr<DecoderQueue>, model_id_hash> decoder_queue_map_;
-
-    // Tells if a given model name and language code is available for use.
-    inline bool is_model_present(const model_id_t &) const noexcept;
+    // A configured model and its decoders (when loaded)
+    struct ModelEntry {
+        ModelSpec model_spec;
+        // Thread-safe Decoder MPMC Queue (null while not loaded). Requests hold
+        // their own reference, so an evicted queue is freed once they finish.
+        std::shared_ptr<DecoderQueue> decoder_queue;
+        // pending load that concurrent requests for the model wait on
+        std::shared_future<std::shared_ptr<DecoderQueue>> loading;
+        // entries with the same key share one model (see `ModelRegistry`)
+        std::string model_key;
+        // estimated memory footprint (size of the model dir and of the graph
+        // dirs outside it), counted once per shared model
+        std::size_t memory_bytes;
+        std::chrono::steady_clock::time_point last_used;
+    };
+
+    typedef std::unordered_map<model_id_t, ModelEntry, model_id_hash> models_t;
+
+    // Models for diff languages/models (swapped as a whole on reload)
+    models_t models_;
+    std::mutex models_mutex_;
+    // incremented on every reload (lazy loads started before are discarded)
+    std::size_t generation_;
+    // entries loading the same model share it (a fresh registry per reload,
+    // so that reloads read the model files again)
+    std::shared_ptr<ModelRegistry> registry_;
+
+    // memory budget for loaded models (0 is unlimited)
+    std::size_t memory_budget_bytes_;
+
+    // cancels stalled and overlong streams
+    StreamWatchdog watchdog_;
+
+    // Gets the decoder queue of a model, loading it first if needed (concurrent
+    // requests share a single load).
+    grpc::Status get_decoder_queue_(const model_id_t &, std::shared_ptr<DecoderQueue> &);
+
+    // Evicts least recently used idle lazy models (except the given one) until
+    // the loaded models fit in the memory budget. Entries sharing a model are
+    // evicted together, as its memory is only freed with its last holder.
+    // The evicted decoder queues are moved out, to be freed by the caller
+    // after unlocking. Needs `models_mutex_`.
+    void evict_models_(const model_id_t &, std::vector<std::shared_ptr<DecoderQueue>> &);
+
+    // Publishes the estimated memory of the loaded models (`models_loaded_mb`).
+    // Needs `models_mutex_`.
+    void update_loaded_memory_() const;
+
+    // Estimated memory footprint of the model for a spec
+    static std::size_t model_memory_bytes_(const ModelSpec &);
+
+    // Builds the model entries for the given specs, loading the non lazy ones.
+    static models_t load_models_(const std::vector<ModelSpec> &, ModelRegistry *const);
+
+    // Status for a request that the client cancelled (or that is past its
+    // deadline). Counted per model as `cancelled_requests`.
+    static grpc::Status cancelled_(const grpc::ServerContext *const, const ModelSpec &);
+
+    // Starts decoding an utterance as per the request config (search parameter
+    // overrides and graph). Decoding stops once the request is cancelled (see
+    // `Decoder::set_cancel_check`). Releases the decoder if the config is
+    // invalid or the request was cancelled while waiting for it.
+    grpc::Status start_decoding_(grpc::ServerContext *const,
+                                 DecoderQueue *const,
+                                 Decoder *const,
+                                 const std::string &,
+                                 const kaldi_serve::RecognitionConfig &);
+
+    // Gets the final results of an utterance into the response and releases
+    // the decoder. The decoder goes back into its queue as soon as the search
+    // state is not needed anymore, i.e. before lattice post-processing.
+    // If a first pass writer is given (and the model does RNNLM rescoring),
+    // the first pass results are written with it while rescoring runs in the
+    // background. Lattice post-processing is skipped for cancelled requests.
+    grpc::Status finish_decoding_(grpc::ServerContext *const,
+                                  DecoderQueue *const,
+                                  Decoder *const,
+                                  const kaldi_serve::RecognitionConfig &,
+                                  kaldi_serve::RecognizeResponse *const,
+                                  const std::function<void(const kaldi_serve::RecognizeResponse &)> &write_first_pass=nullptr);
 
   public:
-    explicit KaldiServeImpl(const std::vector<ModelSpec> &) noexcept;
+    explicit KaldiServeImpl(const std::vector<ModelSpec> &, const std::size_t &memory_budget_mb=0) noexcept;
+
+    // Replaces the served models with newly loaded ones (as per the given
+    // specs) without interrupting in-flight requests, which finish on the
+    // old models. Old models are freed once their last request is done. If
+    // any of the new models fails to load, the old ones are kept.
+    void reload(const std::vector<ModelSpec> &);
 
     // Non-Streaming Request Handler RPC service
     // Accepts a single `RecognizeRequest` message
@@ -95,17 +348,365 @@ class KaldiServeImpl final : public kaldi_serve::KaldiServe::Service {
     // Returns a stream of `RecognizeResponse` messages
     grpc::Status BidiStreamingRecognize(grpc::ServerContext *const,
                                         grpc::ServerReaderWriter<kaldi_serve::RecognizeResponse, kaldi_serve::RecognizeRequest>*) override;
+
+    // Metrics Request Handler RPC service
+    // Returns the current values of all runtime metrics
+    grpc::Status GetMetrics(grpc::ServerContext *const,
+                            const kaldi_serve::MetricsRequest *const,
+                            kaldi_serve::MetricsResponse *const) override;
 };
 
-KaldiServeImpl::KaldiServeImpl(const std::vector<ModelSpec> &model_specs) noexcept {
+KaldiServeImpl::KaldiServeImpl(const std::vector<ModelSpec> &model_specs,
+                               const std::size_t &memory_budget_mb) noexcept
+    : generation_(0), registry_(std::make_shared<ModelRegistry>()),
+      memory_budget_bytes_(memory_budget_mb << 20) {
+    models_ = load_models_(model_specs, registry_.get());
+    update_loaded_memory_();
+}
+
+KaldiServeImpl::models_t KaldiServeImpl::load_models_(const std::vector<ModelSpec> &model_specs,
+                                                      ModelRegistry *const registry) {
+    models_t models;
+
+    std::vector<const ModelSpec *> eager_specs;
     for (auto const &model_spec : model_specs) {
         model_id_t model_id = std::make_pair(model_spec.name, model_spec.language_code);
-        decoder_queue_map_[model_id] = std::unique_ptr<DecoderQueue>(new DecoderQueue(model_spec));
+        ModelEntry &entry = models[model_id];
+        entry.model_spec = model_spec;
+        entry.model_key = ModelRegistry::load_key(model_spec);
+        entry.memory_bytes = model_memory_bytes_(model_spec);
+
+        if (!model_spec.lazy) eager_specs.push_back(&entry.model_spec);
+    }
+
+    // models are loaded concurrently, at most as many at a time as there are
+    // cores (each model also loads its components in parallel)
+    const std::size_t max_loads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (std::size_t batch_start = 0; batch_start < eager_specs.size(); batch_start += max_loads) {
+        const std::size_t batch_end = std::min(batch_start + max_loads, eager_specs.size());
+
+        std::vector<std::future<std::shared_ptr<DecoderQueue>>> loads;
+        for (std::size_t i = batch_start; i < batch_end; i++) {
+            const ModelSpec &model_spec = *eager_specs[i];
+            loads.push_back(std::async(std::launch::async, [&model_spec, registry]() {
+                return std::make_shared<DecoderQueue>(model_spec, registry);
+            }));
+        }
+
+        for (std::size_t i = batch_start; i < batch_end; i++) {
+            model_id_t model_id = std::make_pair(eager_specs[i]->name, eager_specs[i]->language_code);
+            models[model_id].decoder_queue = loads[i - batch_start].get();
+        }
+    }
+
+    return models;
+}
+
+void KaldiServeImpl::reload(const std::vector<ModelSpec> &model_specs) {
+    auto start_time = std::chrono::steady_clock::now();
+
+    // new models are loaded while the current ones keep serving
+    std::shared_ptr<ModelRegistry> registry = std::make_shared<ModelRegistry>();
+    models_t models;
+    try {
+        models = load_models_(model_specs, registry.get());
+    } catch (std::exception &e) {
+        KALDI_WARN << "Reload failed, keeping the current models: " << e.what();
+        metrics().increment("model_reload_failures");
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(models_mutex_);
+        models_.swap(models);
+        registry_.swap(registry);
+        generation_++;
+        update_loaded_memory_();
+    }
+    // old decoder queues not in use are freed here (outside the lock), the
+    // rest once their in-flight requests release them
+    models.clear();
+
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time);
+    std::cout << ":: Reloaded " << model_specs.size() << " models in " << ms.count() << "ms" << ENDL;
+    metrics().increment("model_reloads");
+}
+
+grpc::Status KaldiServeImpl::get_decoder_queue_(const model_id_t &model_id,
+                                                std::shared_ptr<DecoderQueue> &decoder_queue) {
+    std::shared_future<std::shared_ptr<DecoderQueue>> loading;
+    std::size_t generation;
+    {
+        std::lock_guard<std::mutex> lock(models_mutex_);
+        generation = generation_;
+
+        auto it = models_.find(model_id);
+        if (it == models_.end()) {
+            return grpc::Status(grpc::StatusCode::NOT_FOUND, "Model " + model_id.first + " (" + model_id.second + ") not found");
+        }
+
+        ModelEntry &entry = it->second;
+        entry.last_used = std::chrono::steady_clock::now();
+
+        if (entry.decoder_queue) {
+            decoder_queue = entry.decoder_queue;
+            return grpc::Status::OK;
+        }
+
+        if (!entry.loading.valid()) {
+            std::cout << ":: Lazily loading model " << model_id.first << " (" << model_id.second << ")" << ENDL;
+
+            const ModelSpec model_spec = entry.model_spec;
+            std::shared_ptr<ModelRegistry> registry = registry_;
+            entry.loading = std::async(std::launch::async, [model_spec, registry]() {
+                return std::make_shared<DecoderQueue>(model_spec, registry.get());
+            }).share();
+        }
+        loading = entry.loading;
+    }
+
+    // wait for the load without holding up requests for other models
+    std::string error;
+    try {
+        decoder_queue = loading.get();
+    } catch (std::exception &e) {
+        error = e.what();
+    }
+
+    // evicted models are freed after unlocking (declared before the lock)
+    std::vector<std::shared_ptr<DecoderQueue>> evicted;
+    std::lock_guard<std::mutex> lock(models_mutex_);
+
+    if (generation != generation_) {
+        // models were reloaded meanwhile, this request still uses what it loaded
+        if (!error.empty()) {
+            return grpc::Status(grpc::StatusCode::UNAVAILABLE,
+                                "Model " + model_id.first + " (" + model_id.second + ") failed to load: " + error);
+        }
+        return grpc::Status::OK;
+    }
+    ModelEntry &entry = models_[model_id];
+
+    if (!error.empty()) {
+        // the next request retries the load
+        if (entry.loading.valid()) {
+            entry.loading = std::shared_future<std::shared_ptr<DecoderQueue>>();
+            metrics().increment(model_metric("model_load_failures", entry.model_spec));
+        }
+        return grpc::Status(grpc::StatusCode::UNAVAILABLE,
+                            "Model " + model_id.first + " (" + model_id.second + ") failed to load: " + error);
+    }
+
+    // first of the waiting requests to get here installs the queue
+    if (entry.loading.valid()) {
+        entry.decoder_queue = decoder_queue;
+        entry.loading = std::shared_future<std::shared_ptr<DecoderQueue>>();
+        metrics().increment(model_metric("model_loads", entry.model_spec));
+
+        evict_models_(model_id, evicted);
+        update_loaded_memory_();
+    }
+    return grpc::Status::OK;
+}
+
+void KaldiServeImpl::evict_models_(const model_id_t &loaded_model_id,
+                                   std::vector<std::shared_ptr<DecoderQueue>> &evicted) {
+    if (memory_budget_bytes_ == 0) return;
+
+    // loaded entries by the model they share
+    std::unordered_map<std::string, std::vector<ModelEntry *>> loaded_models;
+    for (auto &model : models_) {
+        if (model.second.decoder_queue) loaded_models[model.second.model_key].push_back(&model.second);
+    }
+
+    std::size_t loaded_bytes = 0;
+    for (auto const &loaded_model : loaded_models) {
+        loaded_bytes += loaded_model.second.front()->memory_bytes;
+    }
+
+    while (loaded_bytes > memory_budget_bytes_) {
+        // least recently used model whose entries are all lazy and not serving any request
+        auto lru_model = loaded_models.end();
+        std::chrono::steady_clock::time_point lru_last_used;
+        for (auto it = loaded_models.begin(); it != loaded_models.end(); ++it) {
+            bool evictable = true;
+            std::chrono::steady_clock::time_point last_used;
+            for (ModelEntry *entry : it->second) {
+                const model_id_t model_id = std::make_pair(entry->model_spec.name, entry->model_spec.language_code);
+                if (model_id == loaded_model_id || !entry->model_spec.lazy || entry->decoder_queue.use_count() > 1) {
+                    evictable = false;
+                    break;
+                }
+                last_used = std::max(last_used, entry->last_used);
+            }
+            if (!evictable) continue;
+
+            if (lru_model == loaded_models.end() || last_used < lru_last_used) {
+                lru_model = it;
+                lru_last_used = last_used;
+            }
+        }
+
+        if (lru_model == loaded_models.end()) {
+            KALDI_WARN << "Loaded models (" << (loaded_bytes >> 20) << " MB) exceed the memory budget ("
+                       << (memory_budget_bytes_ >> 20) << " MB) but none can be evicted.";
+            break;
+        }
+
+        for (ModelEntry *entry : lru_model->second) {
+            std::cout << ":: Evicting model " << entry->model_spec.name
+                      << " (" << entry->model_spec.language_code << ")" << ENDL;
+
+            evicted.push_back(std::move(entry->decoder_queue));
+            metrics().increment(model_metric("model_evictions", entry->model_spec));
+        }
+        loaded_bytes -= lru_model->second.front()->memory_bytes;
+        loaded_models.erase(lru_model);
+    }
+}
+
+void KaldiServeImpl::update_loaded_memory_() const {
+    // shared models are counted once
+    std::unordered_map<std::string, std::size_t> loaded_models;
+    for (auto const &model : models_) {
+        if (model.second.decoder_queue) loaded_models[model.second.model_key] = model.second.memory_bytes;
+    }
+
+    std::size_t loaded_bytes = 0;
+    for (auto const &loaded_model : loaded_models) {
+        loaded_bytes += loaded_model.second;
+    }
+    metrics().set("models_loaded_mb", loaded_bytes >> 20);
+}
+
+std::size_t KaldiServeImpl::model_memory_bytes_(const ModelSpec &model_spec) {
+    const std::string model_path = canonical_path(model_spec.path);
+    std::size_t bytes = directory_size(model_path);
+
+    // graphs within the model dir are already counted with it
+    const std::string root_dir = ModelBundle::root_dir(model_spec.path);
+    for (auto const &graph : model_spec.graphs) {
+        const std::string graph_dir = canonical_path(expand_relative_path(graph.second, root_dir));
+        if (graph_dir.compare(0, model_path.size() + 1, model_path + "/") != 0) {
+            bytes += directory_size(graph_dir);
+        }
     }
+    return bytes;
 }
 
-inline bool KaldiServeImpl::is_model_present(const model_id_t &model_id) const noexcept {
-    return decoder_queue_map_.find(model_id) != decoder_queue_map_.end();
+grpc::Status KaldiServeImpl::cancelled_(const grpc::ServerContext *const context, const ModelSpec &model_spec) {
+    metrics().increment(model_metric("cancelled_requests", model_spec));
+
+    if (context->deadline() < std::chrono::system_clock::now()) {
+        return grpc::Status(grpc::StatusCode::DEADLINE_EXCEEDED, "Deadline exceeded, decoding stopped");
+    }
+    return grpc::Status(grpc::StatusCode::CANCELLED, "Request cancelled, decoding stopped");
+}
+
+grpc::Status KaldiServeImpl::start_decoding_(grpc::ServerContext *const context,
+                                             DecoderQueue *const decoder_queue,
+                                             Decoder *const decoder,
+                                             const std::string &uuid,
+                                             const kaldi_serve::RecognitionConfig &config) {
+    // the client may have given up while waiting for a decoder
+    if (context->IsCancelled()) {
+        grpc::Status status = cancelled_(context, decoder->model_spec());
+        decoder_queue->release(decoder);
+        return status;
+    }
+
+    if (!decoder->model()->has_graph(config.graph())) {
+        decoder_queue->release(decoder);
+        return grpc::Status(grpc::StatusCode::NOT_FOUND, "Graph " + config.graph() + " not found for model " +
+                                                         config.model() + " (" + config.language_code() + ")");
+    }
+
+    decoder->override_search_config(config.beam(), config.max_active(), config.lattice_beam());
+    decoder->start_decoding(uuid, config.graph());
+    decoder->set_cancel_check([context]() { return context->IsCancelled(); });
+    return grpc::Status::OK;
+}
+
+grpc::Status KaldiServeImpl::finish_decoding_(grpc::ServerContext *const context,
+                                              DecoderQueue *const decoder_queue,
+                                              Decoder *const decoder,
+                                              const kaldi_serve::RecognitionConfig &config,
+                                              kaldi_serve::RecognizeResponse *const response,
+                                              const std::function<void(const kaldi_serve::RecognizeResponse &)> &write_first_pass) {
+    const int32 n_best = config.max_alternatives();
+    const bool word_level = config.word_level();
+
+    // model and options stay valid after the decoder has been released
+    ChainModel *const model = decoder->model();
+    const ModelSpec &model_spec = decoder->model_spec();
+    const DecoderOptions options = decoder->options;
+
+    utterance_results_t k_results_;
+    kaldi::CompactLattice clat;
+    bool has_lattice = false;
+
+    add_search_params_to_response(decoder->search_config(), response);
+
+    grpc::Status status = grpc::Status::OK;
+    try {
+        if (decoder->needs_lattice(n_best, word_level)) {
+            has_lattice = decoder->get_decoded_lattice(clat);
+        } else {
+            decoder->get_decoded_results(n_best, k_results_, word_level);
+        }
+    } catch (DecodingCancelled &) {
+        status = cancelled_(context, model_spec);
+    } catch (std::exception &e) {
+        status = grpc::Status(grpc::StatusCode::INTERNAL, e.what());
+    }
+
+    // Decoder Release ::
+    // - Releases the lock on the decoder and pushes back into queue.
+    // - Notifies another request handler thread of availability.
+    // - Lattice post-processing (rescoring, n-best, word alignment) below
+    //   does not hold up a decoder.
+    decoder->free_decoder();
+    decoder_queue->release(decoder);
+
+    if (!status.ok()) return status;
+    if (has_lattice && context->IsCancelled()) return cancelled_(context, model_spec);
+
+    if (has_lattice) {
+        try {
+            if (write_first_pass && options.enable_rnnlm) {
+                // the first pass is not rescored at all, all LM rescoring
+                // (and its cost) goes to the follow-up result
+                kaldi::CompactLattice first_pass_clat(clat);
+                DecoderOptions first_pass_options = options;
+                first_pass_options.enable_carpa = false;
+                first_pass_options.enable_rnnlm = false;
+
+                // rescoring runs in the background while the first pass results are sent
+                std::future<void> rescoring = std::async(std::launch::async, [&]() {
+                    find_alternatives(clat, n_best, k_results_, word_level, model, options);
+                });
+
+                utterance_results_t first_pass_results;
+                find_alternatives(first_pass_clat, n_best, first_pass_results, word_level, model, first_pass_options);
+
+                kaldi_serve::RecognizeResponse first_pass_response;
+                first_pass_response.set_first_pass(true);
+                first_pass_response.mutable_search_params()->CopyFrom(response->search_params());
+                add_alternatives_to_response(first_pass_results, &first_pass_response, config);
+                write_first_pass(first_pass_response);
+
+                rescoring.get();
+            } else {
+                find_alternatives(clat, n_best, k_results_, word_level, model, options);
+            }
+        } catch (std::exception &e) {
+            return grpc::Status(grpc::StatusCode::INTERNAL, e.what());
+        }
+    }
+
+    add_alternatives_to_response(k_results_, response, config);
+    return grpc::Status::OK;
 }
 
 grpc::Status KaldiServeImpl::Recognize(grpc::ServerContext *const context,
@@ -113,15 +714,14 @@ grpc::Status KaldiServeImpl::Recognize(grpc::ServerContext *const context,
                                        kaldi_serve::RecognizeResponse *const response) {
     const kaldi_serve::RecognitionConfig config = request->config();
     std::string uuid = request->uuid();
-    const int32 n_best = config.max_alternatives();
     const int32 sample_rate_hertz = config.sample_rate_hertz();
     const std::string model_name = config.model();
     const std::string language_code = config.language_code();
     const model_id_t model_id = std::make_pair(model_name, language_code);
 
-    if (!is_model_present(model_id)) {
-        return grpc::Status(grpc::StatusCode::NOT_FOUND, "Model " + model_name + " (" + language_code + ") not found");
-    }
+    std::shared_ptr<DecoderQueue> decoder_queue;
+    grpc::Status status = get_decoder_queue_(model_id, decoder_queue);
+    if (!status.ok()) return status;
 
     std::chrono::system_clock::time_point start_time;
     if (DEBUG) start_time = std::chrono::system_clock::now();
@@ -130,7 +730,7 @@ grpc::Status KaldiServeImpl::Recognize(grpc::ServerContext *const context,
     // - Tries to attain lock and obtain decoder from the queue.
     // - Waits here until lock on queue is attained.
     // - Each new audio stream gets separate decoder object.
-    Decoder *decoder_ = decoder_queue_map_[model_id]->acquire();
+    Decoder *decoder_ = decoder_queue->acquire();
 
     if (DEBUG) {
         std::chrono::system_clock::time_point end_time = std::chrono::system_clock::now();
@@ -142,7 +742,8 @@ grpc::Status KaldiServeImpl::Recognize(grpc::ServerContext *const context,
     std::stringstream input_stream(audio.content());
 
     if (DEBUG) start_time = std::chrono::system_clock::now();
-    decoder_->start_decoding(uuid);
+    status = start_decoding_(context, decoder_queue.get(), decoder_, uuid, config);
+    if (!status.ok()) return status;
 
     // decode speech signals in chunks
     try {
@@ -151,25 +752,22 @@ grpc::Status KaldiServeImpl::Recognize(grpc::ServerContext *const context,
         } else {
             decoder_->decode_wav_audio(input_stream);
         }
+    } catch (DecodingCancelled &) {
+        status = cancelled_(context, decoder_->model_spec());
+        decoder_->free_decoder();
+        decoder_queue->release(decoder_);
+        return status;
     } catch (kaldi::KaldiFatalError &e) {
-        decoder_queue_map_[model_id]->release(decoder_);
+        decoder_queue->release(decoder_);
         std::string message = std::string(e.what()) + " :: " + std::string(e.KaldiMessage());
         return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, message);
     } catch (std::exception &e) {
-        decoder_queue_map_[model_id]->release(decoder_);
+        decoder_queue->release(decoder_);
         return grpc::Status(grpc::StatusCode::INTERNAL, e.what());
     }
 
-    utterance_results_t k_results_;
-    decoder_->get_decoded_results(n_best, k_results_, config.word_level());
-
-    add_alternatives_to_response(k_results_, response, config);
-
-    // Decoder Release ::
-    // - Releases the lock on the decoder and pushes back into queue.
-    // - Notifies another request handler thread of availability.
-    decoder_->free_decoder();
-    decoder_queue_map_[model_id]->release(decoder_);
+    status = finish_decoding_(context, decoder_queue.get(), decoder_, config, response);
+    if (!status.ok()) return status;
 
     if (DEBUG) {
         std::chrono::system_clock::time_point end_time = std::chrono::system_clock::now();
@@ -191,15 +789,14 @@ grpc::Status KaldiServeImpl::StreamingRecognize(grpc::ServerContext *const conte
     // Assuming: config may change mid-way (only `raw` and `data_bytes` fields)
     kaldi_serve::RecognitionConfig config = request_.config();
     std::string uuid = request_.uuid();
-    const int32 n_best = config.max_alternatives();
     const int32 sample_rate_hertz = config.sample_rate_hertz();
     const std::string model_name = config.model();
     const std::string language_code = config.language_code();
     const model_id_t model_id = std::make_pair(model_name, language_code);
 
-    if (!is_model_present(model_id)) {
-        return grpc::Status(grpc::StatusCode::NOT_FOUND, "Model " + model_name + " (" + language_code + ") not found");
-    }
+    std::shared_ptr<DecoderQueue> decoder_queue;
+    grpc::Status status = get_decoder_queue_(model_id, decoder_queue);
+    if (!status.ok()) return status;
 
     std::chrono::system_clock::time_point start_time, start_time_req;
     if (DEBUG) start_time = std::chrono::system_clock::now();
@@ -208,7 +805,7 @@ grpc::Status KaldiServeImpl::StreamingRecognize(grpc::ServerContext *const conte
     // - Tries to attain lock and obtain decoder from the queue.
     // - Waits here until lock on queue is attained.
     // - Each new audio stream gets separate decoder object.
-    Decoder *decoder_ = decoder_queue_map_[model_id]->acquire();
+    Decoder *decoder_ = decoder_queue->acquire();
 
     if (DEBUG) {
         std::chrono::system_clock::time_point end_time = std::chrono::system_clock::now();
@@ -220,10 +817,14 @@ grpc::Status KaldiServeImpl::StreamingRecognize(grpc::ServerContext *const conte
     int bytes = 0;
 
     if (DEBUG) start_time_req = std::chrono::system_clock::now();
-    decoder_->start_decoding(uuid);
+    status = start_decoding_(context, decoder_queue.get(), decoder_, uuid, config);
+    if (!status.ok()) return status;
+
+    // stalled or overlong streams get cancelled, which releases the decoder
+    StreamWatchdog::Session session(watchdog_, context, decoder_->model_spec());
 
     // read chunks until end of stream
-    do {
+    while (true) {
         if (DEBUG) {
             // LOG REQUEST RESOLVE TIME --> START (at the last request since that would be the actual latency)
             start_time = std::chrono::system_clock::now();
@@ -257,12 +858,17 @@ grpc::Status KaldiServeImpl::StreamingRecognize(grpc::ServerContext *const conte
             } else {
                 decoder_->decode_stream_wav_chunk(input_stream_chunk);
             }
+        } catch (DecodingCancelled &) {
+            status = cancelled_(context, decoder_->model_spec());
+            decoder_->free_decoder();
+            decoder_queue->release(decoder_);
+            return status;
         } catch (kaldi::KaldiFatalError &e) {
-            decoder_queue_map_[model_id]->release(decoder_);
+            decoder_queue->release(decoder_);
             std::string message = std::string(e.what()) + " :: " + std::string(e.KaldiMessage());
             return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, message);
         } catch (std::exception &e) {
-            decoder_queue_map_[model_id]->release(decoder_);
+            decoder_queue->release(decoder_);
             return grpc::Status(grpc::StatusCode::INTERNAL, e.what());
         }
 
@@ -280,20 +886,19 @@ grpc::Status KaldiServeImpl::StreamingRecognize(grpc::ServerContext *const conte
 
             std::cout << debug_msg.str() << ENDL;
         }
-    } while (reader->Read(&request_));
 
-    if (DEBUG) start_time = std::chrono::system_clock::now();
+        session.begin_read();
+        const bool has_chunk = reader->Read(&request_);
+        session.end_read();
+        if (!has_chunk) break;
+    }
+    // only reading is limited, not decoding the rest of the audio
+    session.end();
 
-    utterance_results_t k_results_;
-    decoder_->get_decoded_results(n_best, k_results_, config.word_level());
+    if (DEBUG) start_time = std::chrono::system_clock::now();
 
-    add_alternatives_to_response(k_results_, response, config);
-
-    // Decoder Release ::
-    // - Releases the lock on the decoder and pushes back into queue.
-    // - Notifies another request handler thread of availability.
-    decoder_->free_decoder();
-    decoder_queue_map_[model_id]->release(decoder_);
+    status = finish_decoding_(context, decoder_queue.get(), decoder_, config, response);
+    if (!status.ok()) return status;
 
     if (DEBUG) {
         std::chrono::system_clock::time_point end_time_req = std::chrono::system_clock::now();
@@ -323,9 +928,9 @@ grpc::Status KaldiServeImpl::BidiStreamingRecognize(grpc::ServerContext *const c
     const std::string language_code = config.language_code();
     const model_id_t model_id = std::make_pair(model_name, language_code);
 
-    if (!is_model_present(model_id)) {
-        return grpc::Status(grpc::StatusCode::NOT_FOUND, "Model " + model_name + " (" + language_code + ") not found");
-    }
+    std::shared_ptr<DecoderQueue> decoder_queue;
+    grpc::Status status = get_decoder_queue_(model_id, decoder_queue);
+    if (!status.ok()) return status;
 
     std::chrono::system_clock::time_point start_time, start_time_req;
     if (DEBUG) start_time = std::chrono::system_clock::now();
@@ -334,7 +939,7 @@ grpc::Status KaldiServeImpl::BidiStreamingRecognize(grpc::ServerContext *const c
     // - Tries to attain lock and obtain decoder from the queue.
     // - Waits here until lock on queue is attained.
     // - Each new audio stream gets separate decoder object.
-    Decoder *decoder_ = decoder_queue_map_[model_id]->acquire();
+    Decoder *decoder_ = decoder_queue->acquire();
 
     if (DEBUG) {
         std::chrono::system_clock::time_point end_time = std::chrono::system_clock::now();
@@ -346,10 +951,14 @@ grpc::Status KaldiServeImpl::BidiStreamingRecognize(grpc::ServerContext *const c
     int bytes = 0;
 
     if (DEBUG) start_time_req = std::chrono::system_clock::now();
-    decoder_->start_decoding(uuid);
+    status = start_decoding_(context, decoder_queue.get(), decoder_, uuid, config);
+    if (!status.ok()) return status;
+
+    // stalled or overlong streams get cancelled, which releases the decoder
+    StreamWatchdog::Session session(watchdog_, context, decoder_->model_spec());
 
     // read chunks until end of stream
-    do {
+    while (true) {
         if (DEBUG) {
             start_time = std::chrono::system_clock::now();
 
@@ -388,15 +997,21 @@ grpc::Status KaldiServeImpl::BidiStreamingRecognize(grpc::ServerContext *const c
 
             kaldi_serve::RecognizeResponse response_;
             add_alternatives_to_response(k_results_, &response_, config);
+            add_search_params_to_response(decoder_->search_config(), &response_);
 
             stream->Write(response_);
 
+        } catch (DecodingCancelled &) {
+            status = cancelled_(context, decoder_->model_spec());
+            decoder_->free_decoder();
+            decoder_queue->release(decoder_);
+            return status;
         } catch (kaldi::KaldiFatalError &e) {
-            decoder_queue_map_[model_id]->release(decoder_);
+            decoder_queue->release(decoder_);
             std::string message = std::string(e.what()) + " :: " + std::string(e.KaldiMessage());
             return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, message);
         } catch (std::exception &e) {
-            decoder_queue_map_[model_id]->release(decoder_);
+            decoder_queue->release(decoder_);
             return grpc::Status(grpc::StatusCode::INTERNAL, e.what());
         }
 
@@ -414,24 +1029,30 @@ grpc::Status KaldiServeImpl::BidiStreamingRecognize(grpc::ServerContext *const c
 
             std::cout << debug_msg.str() << ENDL;
         }
-    } while (stream->Read(&request_));
 
-    if (DEBUG) start_time = std::chrono::system_clock::now();
+        session.begin_read();
+        const bool has_chunk = stream->Read(&request_);
+        session.end_read();
+        if (!has_chunk) break;
+    }
+    // only reading is limited, not decoding the rest of the audio
+    session.end();
 
-    utterance_results_t k_results_;
-    decoder_->get_decoded_results(n_best, k_results_, config.word_level());
+    if (DEBUG) start_time = std::chrono::system_clock::now();
 
     kaldi_serve::RecognizeResponse response_;
-    add_alternatives_to_response(k_results_, &response_, config);
+    if (config.two_pass()) {
+        status = finish_decoding_(context, decoder_queue.get(), decoder_, config, &response_,
+                                  [stream](const kaldi_serve::RecognizeResponse &first_pass_response) {
+                                      stream->Write(first_pass_response);
+                                  });
+    } else {
+        status = finish_decoding_(context, decoder_queue.get(), decoder_, config, &response_);
+    }
+    if (!status.ok()) return status;
 
     stream->Write(response_);
 
-    // Decoder Release ::
-    // - Releases the lock on the decoder and pushes back into queue.
-    // - Notifies another request handler thread of availability.
-    decoder_->free_decoder();
-    decoder_queue_map_[model_id]->release(decoder_);
-
     if (DEBUG) {
         std::chrono::system_clock::time_point end_time_req = std::chrono::system_clock::now();
         auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end_time_req - start_time);
@@ -445,10 +1066,50 @@ grpc::Status KaldiServeImpl::BidiStreamingRecognize(grpc::ServerContext *const c
     return grpc::Status::OK;
 }
 
+grpc::Status KaldiServeImpl::GetMetrics(grpc::ServerContext *const context,
+                                        const kaldi_serve::MetricsRequest *const request,
+                                        kaldi_serve::MetricsResponse *const response) {
+    for (auto const &metric : metrics().snapshot()) {
+        (*response->mutable_metrics())[metric.first] = metric.second;
+    }
+    return grpc::Status::OK;
+}
+
 
 // Runs the Server with the Kaldi Service
-void run_server(const std::vector<ModelSpec> &model_specs) {
-    KaldiServeImpl service(model_specs);
+void run_server(const std::string &model_spec_toml,
+                const std::vector<ModelSpec> &model_specs,
+                const std::size_t &memory_budget_mb=0) {
+    // SIGHUP is waited for by the reloader thread, so it's blocked here before
+    // any other thread (which inherits the mask) is started
+    sigset_t reload_signals;
+    sigemptyset(&reload_signals);
+    sigaddset(&reload_signals, SIGHUP);
+    pthread_sigmask(SIG_BLOCK, &reload_signals, nullptr);
+
+    // (eager) models are loaded and warmed up before the server starts listening
+    auto start_time = std::chrono::steady_clock::now();
+    KaldiServeImpl service(model_specs, memory_budget_mb);
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time);
+    std::cout << ":: Models ready in " << ms.count() << "ms" << ENDL;
+
+    // Reloads the models from the toml on every SIGHUP
+    std::thread reloader([&service, model_spec_toml, reload_signals]() {
+        int signal;
+        while (sigwait(&reload_signals, &signal) == 0) {
+            std::cout << ":: Reloading models from " << model_spec_toml << ENDL;
+
+            std::vector<ModelSpec> model_specs;
+            try {
+                parse_model_specs(model_spec_toml, model_specs);
+            } catch (std::exception &e) {
+                KALDI_WARN << "Could not parse " << model_spec_toml << ", keeping the current models: " << e.what();
+                continue;
+            }
+            service.reload(model_specs);
+        }
+    });
+    reloader.detach();
 
     std::string server_address("0.0.0.0:5016");
 
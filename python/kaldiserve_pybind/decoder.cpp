@@ -23,8 +23,10 @@ void pybind_decoder(py::module &m) {
     // kaldiserve.Decoder
     py::class_<Decoder>(m, "Decoder", "Decoder class.")
         .def(py::init<ChainModel *const>())
-        .def("start_decoding", &Decoder::start_decoding)
+        .def("start_decoding", &Decoder::start_decoding, py::arg("uuid") = "", py::arg("graph") = "")
         .def("free_decoder", &Decoder::free_decoder)
+        .def("override_search_config", &Decoder::override_search_config,
+             py::arg("beam") = 0, py::arg("max_active") = 0, py::arg("lattice_beam") = 0)
         // wav stream chunk
         .def("decode_stream_wav_chunk", [](Decoder &self, py::bytes &wav_bytes) {
             std::string wav_bytes_str(wav_bytes);
@@ -22,6 +22,12 @@ void pybind_types(py::module &m) {
         .def_readonly("language_code", &ModelSpec::language_code)
         .def_readonly("path", &ModelSpec::path)
         .def_readonly("n_decoders", &ModelSpec::n_decoders)
+        .def_readonly("lazy", &ModelSpec::lazy)
+        .def_readonly("warmup", &ModelSpec::warmup)
+        .def_readonly("warmup_audio", &ModelSpec::warmup_audio)
+        .def_readonly("prefault_graph", &ModelSpec::prefault_graph)
+        .def_readonly("stream_idle_timeout_ms", &ModelSpec::stream_idle_timeout_ms)
+        .def_readonly("max_stream_secs", &ModelSpec::max_stream_secs)
         .def_readonly("min_active", &ModelSpec::min_active)
         .def_readonly("max_active", &ModelSpec::max_active)
         .def_readonly("frame_subsampling_factor", &ModelSpec::frame_subsampling_factor)
@@ -29,8 +35,26 @@ void pybind_types(py::module &m) {
         .def_readonly("lattice_beam", &ModelSpec::lattice_beam)
         .def_readonly("acoustic_scale", &ModelSpec::acoustic_scale)
         .def_readonly("silence_weight", &ModelSpec::silence_weight)
+        .def_readonly("mmap_graph", &ModelSpec::mmap_graph)
+        .def_readonly("lookahead_graph", &ModelSpec::lookahead_graph)
+        .def_readonly("lookahead_cache_mb", &ModelSpec::lookahead_cache_mb)
+        .def_readonly("reorder_graph", &ModelSpec::reorder_graph)
+        .def_readonly("adaptive_pruning", &ModelSpec::adaptive_pruning)
+        .def_readonly("pressure_wait_ms", &ModelSpec::pressure_wait_ms)
+        .def_readonly("pressure_rtf", &ModelSpec::pressure_rtf)
+        .def_readonly("min_max_active", &ModelSpec::min_max_active)
+        .def_readonly("min_beam", &ModelSpec::min_beam)
+        .def_readonly("min_lattice_beam", &ModelSpec::min_lattice_beam)
+        .def_readonly("max_max_active", &ModelSpec::max_max_active)
+        .def_readonly("max_beam", &ModelSpec::max_beam)
+        .def_readonly("max_lattice_beam", &ModelSpec::max_lattice_beam)
+        .def_readonly("word_confidence", &ModelSpec::word_confidence)
+        .def_readonly("carpa_weight", &ModelSpec::carpa_weight)
+        .def_readonly("carpa_compose_beam", &ModelSpec::carpa_compose_beam)
+        .def_readonly("carpa_max_arcs", &ModelSpec::carpa_max_arcs)
         .def_readonly("max_ngram_order", &ModelSpec::max_ngram_order)
         .def_readonly("rnnlm_weight", &ModelSpec::rnnlm_weight)
+        .def_readonly("rnnlm_cache_size", &ModelSpec::rnnlm_cache_size)
         .def_readonly("bos_index", &ModelSpec::bos_index)
         .def_readonly("eos_index", &ModelSpec::eos_index)
         .def("__repr__", [](const ModelSpec &ms) {
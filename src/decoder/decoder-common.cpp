@@ -3,101 +3,89 @@
 // local includes
 #include "config.hpp"
 #include "decoder.hpp"
+#include "metrics.hpp"
 #include "types.hpp"
 
 
 namespace kaldiserve {
 
-void find_alternatives(kaldi::CompactLattice &clat,
-                       const std::size_t &n_best,
-                       utterance_results_t &results,
-                       const bool &word_level,
-                       ChainModel *const model,
-                       const DecoderOptions &options) {
-    if (clat.NumStates() == 0) {
-        KALDI_LOG << "Empty lattice.";
-    }
+// feature frame shift (in secs)
+static const kaldi::BaseFloat FRAME_SHIFT = 0.01;
+
+static void words_to_alternative(const std::vector<int32> &word_ids,
+                                 const kaldi::LatticeWeight &weight,
+                                 const WordTable &word_table,
+                                 Alternative &alt) {
+    word_table.join(word_ids, ' ', alt.transcript);
+    alt.lm_score = float(weight.Value1());
+    alt.am_score = float(weight.Value2());
+    alt.confidence = calculate_confidence(alt.lm_score, alt.am_score, word_ids.size());
+}
 
-    if (options.enable_rnnlm) {
-        // rnnlm.fst
-        std::unique_ptr<kaldi::rnnlm::KaldiRnnlmDeterministicFst> lm_to_add_orig = 
-            make_uniq<kaldi::rnnlm::KaldiRnnlmDeterministicFst>(model->model_spec.max_ngram_order, *model->rnnlm_info);
-        std::unique_ptr<fst::ScaleDeterministicOnDemandFst> lm_to_add =
-            make_uniq<fst::ScaleDeterministicOnDemandFst>(model->rnnlm_weight, lm_to_add_orig.get());
+void path_to_alternative(const kaldi::Lattice &path,
+                         const WordTable &word_table,
+                         Alternative &alt) {
+    // NOTE: Check why int32s specifically are used here
+    std::vector<int32> input_ids;
+    std::vector<int32> word_ids;
 
-        // G.fst
-        std::unique_ptr<fst::BackoffDeterministicOnDemandFst<fst::StdArc>> lm_to_subtract_det_backoff =
-            make_uniq<fst::BackoffDeterministicOnDemandFst<fst::StdArc>>(*model->lm_to_subtract_fst);
-        std::unique_ptr<fst::ScaleDeterministicOnDemandFst> lm_to_subtract_det_scale =
-            make_uniq<fst::ScaleDeterministicOnDemandFst>(-model->rnnlm_weight, lm_to_subtract_det_backoff.get());
-        
-        // combine both LM fsts
-        fst::ComposeDeterministicOnDemandFst<fst::StdArc> combined_lms(lm_to_subtract_det_scale.get(), lm_to_add.get());
-
-        // Before composing with the LM FST, we scale the lattice weights
-        // by the inverse of "lm_scale".  We'll later scale by "lm_scale".
-        // We do it this way so we can determinize and it will give the
-        // right effect (taking the "best path" through the LM) regardless
-        // of the sign of lm_scale.
-        if (model->decodable_opts.acoustic_scale != 1.0) {
-            fst::ScaleLattice(fst::AcousticLatticeScale(model->decodable_opts.acoustic_scale), &clat);
-        }
-        kaldi::TopSortCompactLatticeIfNeeded(&clat);
+    kaldi::LatticeWeight weight;
+    fst::GetLinearSymbolSequence(path, &input_ids, &word_ids, &weight);
 
-        // compose lattice with combined language model.
-        kaldi::CompactLattice composed_clat;
-        kaldi::ComposeCompactLatticePruned(model->compose_opts, clat,
-                                           &combined_lms, &composed_clat);
-
-        if (composed_clat.NumStates() == 0) {
-            // Something went wrong.  A warning will already have been printed.
-            KALDI_WARN << "Empty lattice after RNNLM rescoring.";
-        } else {
-            clat = composed_clat;
-        }
-    }
+    words_to_alternative(word_ids, weight, word_table, alt);
+}
 
-    auto lat = make_uniq<kaldi::Lattice>();
-    fst::ConvertLattice(clat, lat.get());
+void path_to_alternative(const LatticePath &path,
+                         const WordTable &word_table,
+                         Alternative &alt) {
+    words_to_alternative(path.word_ids, path.weight, word_table, alt);
+}
 
-    kaldi::Lattice nbest_lat;
-    std::vector<kaldi::Lattice> nbest_lats;
+static void align_path_words(const kaldi::CompactLattice &clat,
+                             const LatticePath &path,
+                             ChainModel *const model,
+                             const WordTable &word_table,
+                             Alternative &alt) {
+    kaldi::CompactLattice linear_clat, aligned_clat;
+    path_to_linear_lattice(clat, path, &linear_clat);
 
-    fst::ShortestPath(*lat, &nbest_lat, n_best);
-    fst::ConvertNbestToVector(nbest_lat, &nbest_lats);
+    bool ok = kaldi::WordAlignLattice(linear_clat, model->trans_model, *model->wb_info, 0, &aligned_clat);
 
-    if (nbest_lats.empty()) {
-        KALDI_WARN << "no N-best entries";
+    if (aligned_clat.Start() == fst::kNoStateId) {
+        KALDI_WARN << "Empty aligned path, producing no word level output for it.";
         return;
     }
+    if (!ok) {
+        KALDI_WARN << "Outputting partial word alignment";
+    }
 
-    for (auto const &l : nbest_lats) {
-        // NOTE: Check why int32s specifically are used here
-        std::vector<int32> input_ids;
-        std::vector<int32> word_ids;
-        std::vector<std::string> word_strings;
-        std::string sentence;
+    std::vector<int32> word_ids, begin_times, lengths;
+    if (!kaldi::CompactLatticeToWordAlignment(aligned_clat, &word_ids, &begin_times, &lengths)) {
+        KALDI_WARN << "Could not get word alignment from path, producing no word level output for it.";
+        return;
+    }
 
-        kaldi::LatticeWeight weight;
-        fst::GetLinearSymbolSequence(l, &input_ids, &word_ids, &weight);
+    const kaldi::BaseFloat time_unit = FRAME_SHIFT * model->decodable_opts.frame_subsampling_factor;
 
-        for (auto const &wid : word_ids) {
-            word_strings.push_back(model->word_syms->Find(wid));
-        }
-        string_join(word_strings, " ", sentence);
+    alt.words.clear();
+    for (size_t i = 0; i < word_ids.size(); i++) {
+        if (word_ids[i] == 0) continue; // silence
 
-        Alternative alt;
-        alt.transcript = sentence;
-        alt.lm_score = float(weight.Value1());
-        alt.am_score = float(weight.Value2());
-        alt.confidence = calculate_confidence(alt.lm_score, alt.am_score, word_ids.size());
+        Word word;
+        word.start_time = begin_times[i] * time_unit;
+        word.end_time = (begin_times[i] + lengths[i]) * time_unit;
+        word.word = word_table.word(word_ids[i]);
+        // no per word posteriors without MBR, use the alternative's confidence
+        word.confidence = alt.confidence;
 
-        results.push_back(alt);
+        alt.words.push_back(word);
     }
+}
 
-    if (!(options.enable_word_level && word_level))
-      return;
-
+static void find_mbr_words(const kaldi::CompactLattice &clat,
+                           ChainModel *const model,
+                           const WordTable &word_table,
+                           std::vector<Word> &words) {
     kaldi::CompactLattice aligned_clat;
     kaldi::BaseFloat max_expand = 0.0;
     int32 max_states;
@@ -126,11 +114,8 @@ void find_alternatives(kaldi::CompactLattice &clat,
         }
     }
 
-    std::vector<Word> words;
-
     // compute confidences and times only if alignment was ok
     if (ok) {
-        kaldi::BaseFloat frame_shift = 0.01;
         kaldi::BaseFloat lm_scale = 1.0;
         kaldi::MinimumBayesRiskOptions mbr_opts;
         mbr_opts.decode_mbr = false;
@@ -148,15 +133,133 @@ void find_alternatives(kaldi::CompactLattice &clat,
             KALDI_ASSERT(best_words[i] != 0 || mbr_opts.print_silence); // Should not have epsilons.
 
             Word word;
-            kaldi::BaseFloat time_unit = frame_shift * model->decodable_opts.frame_subsampling_factor;
+            kaldi::BaseFloat time_unit = FRAME_SHIFT * model->decodable_opts.frame_subsampling_factor;
             word.start_time = times[i].first * time_unit;
             word.end_time = times[i].second * time_unit;
-            word.word = model->word_syms->Find(best_words[i]); // lookup word in SymbolTable
+            word.word = word_table.word(best_words[i]); // lookup word in WordTable
             word.confidence = conf[i];
 
             words.push_back(word);
         }
     }
+}
+
+
+// Rescores the lattice by (pruned) composition with an on demand LM fst,
+// leaving it as is if composition fails.
+static void compose_lm(kaldi::CompactLattice &clat,
+                       fst::DeterministicOnDemandFst<fst::StdArc> *const lm,
+                       const kaldi::ComposeLatticePrunedOptions &compose_opts,
+                       const std::string &lm_name) {
+    kaldi::TopSortCompactLatticeIfNeeded(&clat);
+
+    // compose lattice with combined language model.
+    kaldi::CompactLattice composed_clat;
+    kaldi::ComposeCompactLatticePruned(compose_opts, clat, lm, &composed_clat);
+
+    if (composed_clat.NumStates() == 0) {
+        // Something went wrong.  A warning will already have been printed.
+        KALDI_WARN << "Empty lattice after " << lm_name << " rescoring.";
+    } else {
+        clat = composed_clat;
+    }
+}
+
+void find_alternatives(kaldi::CompactLattice &clat,
+                       const std::size_t &n_best,
+                       utterance_results_t &results,
+                       const bool &word_level,
+                       ChainModel *const model,
+                       const DecoderOptions &options) {
+    if (clat.NumStates() == 0) {
+        KALDI_LOG << "Empty lattice.";
+    }
+
+    const WordTable &word_table = model->graph_words(options.graph);
+
+    if (options.enable_carpa || options.enable_rnnlm) {
+        // Before composing with the LM FST, we scale the lattice weights
+        // by the inverse of "lm_scale".  We'll later scale by "lm_scale".
+        // We do it this way so we can determinize and it will give the
+        // right effect (taking the "best path" through the LM) regardless
+        // of the sign of lm_scale.
+        if (model->decodable_opts.acoustic_scale != 1.0) {
+            fst::ScaleLattice(fst::AcousticLatticeScale(model->decodable_opts.acoustic_scale), &clat);
+        }
+    }
+
+    if (options.enable_carpa) {
+        // G.carpa
+        kaldi::ConstArpaLmDeterministicFst lm_to_add_orig(*model->carpa_lm);
+        fst::ScaleDeterministicOnDemandFst lm_to_add(model->carpa_weight, &lm_to_add_orig);
+
+        // G.fst
+        fst::BackoffDeterministicOnDemandFst<fst::StdArc> lm_to_subtract_det_backoff(*model->carpa_lm_to_subtract_fst);
+        fst::ScaleDeterministicOnDemandFst lm_to_subtract_det_scale(-model->carpa_weight, &lm_to_subtract_det_backoff);
+
+        // combine both LM fsts
+        fst::ComposeDeterministicOnDemandFst<fst::StdArc> combined_lms(&lm_to_subtract_det_scale, &lm_to_add);
+
+        compose_lm(clat, &combined_lms, model->carpa_compose_opts, "ConstArpa");
+    }
+
+    if (options.enable_rnnlm) {
+        // rnnlm.fst
+        std::unique_ptr<CachedRnnlmDeterministicFst> lm_to_add_orig =
+            make_uniq<CachedRnnlmDeterministicFst>(model->model_spec.max_ngram_order, *model->rnnlm_info, model->rnnlm_cache.get());
+        std::unique_ptr<fst::ScaleDeterministicOnDemandFst> lm_to_add =
+            make_uniq<fst::ScaleDeterministicOnDemandFst>(model->rnnlm_weight, lm_to_add_orig.get());
+
+        // G.fst
+        std::unique_ptr<fst::BackoffDeterministicOnDemandFst<fst::StdArc>> lm_to_subtract_det_backoff =
+            make_uniq<fst::BackoffDeterministicOnDemandFst<fst::StdArc>>(*model->lm_to_subtract_fst);
+        std::unique_ptr<fst::ScaleDeterministicOnDemandFst> lm_to_subtract_det_scale =
+            make_uniq<fst::ScaleDeterministicOnDemandFst>(-model->rnnlm_weight, lm_to_subtract_det_backoff.get());
+        
+        // combine both LM fsts
+        fst::ComposeDeterministicOnDemandFst<fst::StdArc> combined_lms(lm_to_subtract_det_scale.get(), lm_to_add.get());
+
+        compose_lm(clat, &combined_lms, model->compose_opts, "RNNLM");
+
+        metrics().increment(model_metric("rnnlm_cache_hits", model->model_spec), lm_to_add_orig->cache_hits());
+        metrics().increment(model_metric("rnnlm_cache_misses", model->model_spec), lm_to_add_orig->cache_misses());
+    }
+
+    // enumerate the n-best paths lazily, stopping as soon as enough distinct
+    // word sequences have been found
+    kaldi::TopSortCompactLatticeIfNeeded(&clat);
+    LatticePathEnumerator path_enumerator(clat);
+    LatticePath path;
+    // paths are kept around for word alignment
+    std::vector<LatticePath> paths;
+
+    while (results.size() < n_best && path_enumerator.next(path)) {
+        Alternative alt;
+        path_to_alternative(path, word_table, alt);
+        results.push_back(alt);
+        paths.push_back(path);
+    }
+
+    if (results.empty()) {
+        KALDI_WARN << "no N-best entries";
+        return;
+    }
+
+    if (!(options.enable_word_level && word_level))
+      return;
+
+    // word timings for every alternative, from aligning its (linear) path
+    // instead of the full lattice
+    for (std::size_t i = 0; i < results.size(); i++) {
+        align_path_words(clat, paths[i], model, word_table, results[i]);
+    }
+
+    // word confidences for the best alternative need MBR over the full lattice
+    if (!model->model_spec.word_confidence)
+      return;
+
+    std::vector<Word> words;
+    find_mbr_words(clat, model, word_table, words);
 
     if (!results.empty() and !words.empty()) {
         results[0].words = words;
@@ -9,8 +9,21 @@
 
 namespace kaldiserve {
 
-DecoderFactory::DecoderFactory(const ModelSpec &model_spec) : model_spec(model_spec) {
-    model_ = make_uniq<ChainModel>(model_spec);
+SearchProfile::SearchProfile(const ModelSpec &model_spec) : model_spec(model_spec) {
+    decoder_config.min_active = model_spec.min_active;
+    decoder_config.max_active = model_spec.max_active;
+    decoder_config.beam = model_spec.beam;
+    decoder_config.lattice_beam = model_spec.lattice_beam;
+}
+
+DecoderFactory::DecoderFactory(const ModelSpec &model_spec)
+    : model_spec(model_spec), profile_(model_spec) {
+    model_ = std::make_shared<ChainModel>(model_spec);
+}
+
+DecoderFactory::DecoderFactory(const ModelSpec &model_spec, ModelRegistry *const registry)
+    : model_spec(model_spec), profile_(model_spec) {
+    model_ = registry->get(model_spec);
 }
 
 } // namespace kaldiserve
\ No newline at end of file
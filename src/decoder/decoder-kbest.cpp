@@ -0,0 +1,130 @@
+// decoder-kbest.cpp - Lazy K-Best Lattice Path Enumeration Implementation
+
+// stl includes
+#include <algorithm>
+#include <limits>
+
+// local includes
+#include "config.hpp"
+#include "decoder.hpp"
+#include "types.hpp"
+
+
+namespace kaldiserve {
+
+// upper bound on search nodes expanded (guards against lattices where most
+// paths share the same word sequence)
+static const std::size_t MAX_PATH_EXPANSIONS = 100000;
+
+static inline double path_cost(const kaldi::LatticeWeight &weight) noexcept {
+    return weight.Value1() + weight.Value2();
+}
+
+LatticePathEnumerator::LatticePathEnumerator(const kaldi::CompactLattice &clat) : clat_(clat), num_expansions_(0) {
+    const StateId num_states = clat_.NumStates();
+    if (clat_.Start() == fst::kNoStateId) return;
+
+    // exact best cost from every state to a final state (states are in
+    // topological order, so a single backward pass suffices)
+    const double infinity = std::numeric_limits<double>::infinity();
+    backward_costs_.assign(num_states, infinity);
+
+    for (StateId s = num_states - 1; s >= 0; s--) {
+        double best_cost = path_cost(clat_.Final(s).Weight());
+
+        for (fst::ArcIterator<kaldi::CompactLattice> aiter(clat_, s); !aiter.Done(); aiter.Next()) {
+            const kaldi::CompactLatticeArc &arc = aiter.Value();
+            KALDI_ASSERT(arc.nextstate > s && "lattice is not topologically sorted");
+            best_cost = std::min(best_cost, path_cost(arc.weight.Weight()) + backward_costs_[arc.nextstate]);
+        }
+        backward_costs_[s] = best_cost;
+    }
+
+    if (backward_costs_[clat_.Start()] == infinity) return;
+
+    nodes_.push_back(Node{clat_.Start(), -1, -1, 0.0, false});
+    queue_.push(std::make_pair(backward_costs_[clat_.Start()], 0));
+}
+
+bool LatticePathEnumerator::next(LatticePath &path) {
+    while (!queue_.empty() && num_expansions_ < MAX_PATH_EXPANSIONS) {
+        const int32 node_idx = queue_.top().second;
+        queue_.pop();
+        num_expansions_++;
+
+        const Node node = nodes_[node_idx];
+
+        if (node.is_final) {
+            // complete paths come out in order of increasing cost
+            _trace_path(node_idx, path);
+            if (seen_word_seqs_.insert(path.word_ids).second) {
+                return true;
+            }
+            continue;
+        }
+
+        const kaldi::CompactLatticeWeight &final_weight = clat_.Final(node.state);
+        if (final_weight != kaldi::CompactLatticeWeight::Zero()) {
+            const double cost = node.cost + path_cost(final_weight.Weight());
+            nodes_.push_back(Node{node.state, node_idx, -1, cost, true});
+            queue_.push(std::make_pair(cost, int32(nodes_.size() - 1)));
+        }
+
+        int32 arc_idx = 0;
+        for (fst::ArcIterator<kaldi::CompactLattice> aiter(clat_, node.state); !aiter.Done(); aiter.Next(), arc_idx++) {
+            const kaldi::CompactLatticeArc &arc = aiter.Value();
+            const double cost = node.cost + path_cost(arc.weight.Weight());
+            const double backward_cost = backward_costs_[arc.nextstate];
+
+            if (backward_cost == std::numeric_limits<double>::infinity()) continue;
+
+            nodes_.push_back(Node{arc.nextstate, node_idx, arc_idx, cost, false});
+            queue_.push(std::make_pair(cost + backward_cost, int32(nodes_.size() - 1)));
+        }
+    }
+    return false;
+}
+
+void LatticePathEnumerator::_trace_path(const int32 &final_node_idx, LatticePath &path) const {
+    path.word_ids.clear();
+    path.arcs.clear();
+    path.final_state = nodes_[final_node_idx].state;
+    path.weight = clat_.Final(path.final_state).Weight();
+
+    // walk back from the final node, collecting arcs in reverse
+    for (int32 idx = nodes_[final_node_idx].parent; nodes_[idx].parent != -1; idx = nodes_[idx].parent) {
+        const Node &node = nodes_[idx];
+
+        fst::ArcIterator<kaldi::CompactLattice> aiter(clat_, nodes_[node.parent].state);
+        aiter.Seek(node.arc_idx);
+        const kaldi::CompactLatticeArc &arc = aiter.Value();
+
+        path.weight = fst::Times(arc.weight.Weight(), path.weight);
+        if (arc.olabel != 0) path.word_ids.push_back(arc.olabel);
+        path.arcs.push_back(std::make_pair(nodes_[node.parent].state, node.arc_idx));
+    }
+    std::reverse(path.word_ids.begin(), path.word_ids.end());
+    std::reverse(path.arcs.begin(), path.arcs.end());
+}
+
+void path_to_linear_lattice(const kaldi::CompactLattice &clat,
+                            const LatticePath &path,
+                            kaldi::CompactLattice *linear_clat) {
+    linear_clat->DeleteStates();
+
+    int32 cur_state = linear_clat->AddState();
+    linear_clat->SetStart(cur_state);
+
+    for (const auto &state_arc : path.arcs) {
+        fst::ArcIterator<kaldi::CompactLattice> aiter(clat, state_arc.first);
+        aiter.Seek(state_arc.second);
+        kaldi::CompactLatticeArc arc = aiter.Value();
+
+        arc.nextstate = linear_clat->AddState();
+        linear_clat->AddArc(cur_state, arc);
+        cur_state = arc.nextstate;
+    }
+    linear_clat->SetFinal(cur_state, clat.Final(path.final_state));
+}
+
+} // namespace kaldiserve
@@ -0,0 +1,76 @@
+// decoder-pruning.cpp - Adaptive Pruning Controller Implementation
+
+// stl includes
+#include <algorithm>
+
+// local includes
+#include "config.hpp"
+#include "decoder.hpp"
+#include "metrics.hpp"
+#include "types.hpp"
+
+
+namespace kaldiserve {
+
+// weight of the latest observation in the moving averages
+static const double LOAD_SMOOTHING = 0.2;
+// change in pruning level per update
+static const double LEVEL_STEP = 0.1;
+
+PruningController::PruningController(const ModelSpec &model_spec,
+                                     const kaldi::LatticeFasterDecoderConfig &base_config)
+    : model_spec_(model_spec), base_config_(base_config), config_(base_config),
+      avg_wait_ms_(0.0), avg_rtf_(0.0), level_(0.0) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    update_level_();
+}
+
+void PruningController::report_wait(const double &wait_ms) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    avg_wait_ms_ += LOAD_SMOOTHING * (wait_ms - avg_wait_ms_);
+    update_level_();
+}
+
+void PruningController::report_rtf(const double &rtf) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    avg_rtf_ += LOAD_SMOOTHING * (rtf - avg_rtf_);
+    update_level_();
+}
+
+kaldi::LatticeFasterDecoderConfig PruningController::current_config() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return config_;
+}
+
+void PruningController::update_level_() {
+    const bool overloaded = avg_wait_ms_ > model_spec_.pressure_wait_ms ||
+                            avg_rtf_ > model_spec_.pressure_rtf;
+    // relax only once well below the thresholds to avoid oscillating
+    const bool underloaded = avg_wait_ms_ < 0.5 * model_spec_.pressure_wait_ms &&
+                             avg_rtf_ < 0.5 * model_spec_.pressure_rtf;
+
+    if (overloaded) {
+        level_ = std::min(1.0, level_ + LEVEL_STEP);
+    } else if (underloaded) {
+        level_ = std::max(0.0, level_ - LEVEL_STEP);
+    }
+
+    // interpolate between the model's search parameters and the floors
+    const float min_beam = std::min(model_spec_.min_beam, base_config_.beam);
+    const float min_lattice_beam = std::min(model_spec_.min_lattice_beam, base_config_.lattice_beam);
+    const int32 min_max_active = std::max(base_config_.min_active,
+                                          std::min(model_spec_.min_max_active, base_config_.max_active));
+
+    config_.beam = base_config_.beam - level_ * (base_config_.beam - min_beam);
+    config_.lattice_beam = base_config_.lattice_beam - level_ * (base_config_.lattice_beam - min_lattice_beam);
+    config_.max_active = base_config_.max_active - int32(level_ * (base_config_.max_active - min_max_active));
+
+    metrics().set(model_metric("pruning_level", model_spec_), level_);
+    metrics().set(model_metric("search_beam", model_spec_), config_.beam);
+    metrics().set(model_metric("search_max_active", model_spec_), config_.max_active);
+    metrics().set(model_metric("search_lattice_beam", model_spec_), config_.lattice_beam);
+    metrics().set(model_metric("decoder_wait_ms_avg", model_spec_), avg_wait_ms_);
+    metrics().set(model_metric("decoding_rtf_avg", model_spec_), avg_rtf_);
+}
+
+} // namespace kaldiserve
@@ -1,20 +1,60 @@
 // decoder-queue.cpp - Decoder Queue Implementation
 
+// stl includes
+#include <chrono>
+#include <fstream>
+#include <future>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
 // local includes
 #include "config.hpp"
 #include "decoder.hpp"
+#include "graph.hpp"
+#include "metrics.hpp"
+#include "model.hpp"
 #include "types.hpp"
 
 
 namespace kaldiserve {
 
-DecoderQueue::DecoderQueue(const ModelSpec &model_spec) {
+// duration of the synthetic warm-up audio (in secs)
+static const float WARMUP_SECS = 2.0;
+
+// Low level noise as raw 16 bit PCM. Unlike silence, it gets through the
+// whole pipeline (ivectors, search, lattice generation) like speech would.
+static void synthetic_audio(const float &samp_freq, std::string &pcm) {
+    std::minstd_rand rng(0);
+    std::uniform_int_distribution<int> noise(-512, 512);
+
+    const std::size_t n_samples = std::size_t(samp_freq * WARMUP_SECS);
+    pcm.resize(n_samples * sizeof(int16));
+
+    int16 *samples = reinterpret_cast<int16 *>(&pcm[0]);
+    for (std::size_t i = 0; i < n_samples; i++) {
+        samples[i] = int16(noise(rng));
+    }
+}
+
+DecoderQueue::DecoderQueue(const ModelSpec &model_spec, ModelRegistry *const registry) {
     std::cout << ":: Loading model from " << model_spec.path << ENDL;
 
-    decoder_factory_ = make_uniq<DecoderFactory>(model_spec);
+    if (registry != nullptr) {
+        decoder_factory_ = make_uniq<DecoderFactory>(model_spec, registry);
+    } else {
+        decoder_factory_ = make_uniq<DecoderFactory>(model_spec);
+    }
     for (size_t i = 0; i < model_spec.n_decoders; i++) {
         queue_.push(decoder_factory_->produce());
     }
+
+    if (model_spec.adaptive_pruning && !queue_.empty()) {
+        pruning_controller_ = make_uniq<PruningController>(model_spec, queue_.front()->search_config());
+    }
+
+    warmup_(model_spec);
 }
 
 DecoderQueue::~DecoderQueue() {
@@ -26,6 +66,11 @@ DecoderQueue::~DecoderQueue() {
 }
 
 void DecoderQueue::push_(Decoder *const item) {
+    // decoders released without decoding (invalid configs, early
+    // cancellations) have nothing to report
+    double rtf = item->take_real_time_factor();
+    if (pruning_controller_ && rtf > 0) pruning_controller_->report_rtf(rtf);
+
     std::unique_lock<std::mutex> mlock(mutex_);
     queue_.push(item);
     mlock.unlock();
@@ -33,6 +78,8 @@ void DecoderQueue::push_(Decoder *const item) {
 }
 
 Decoder *DecoderQueue::pop_() {
+    auto wait_start_time = std::chrono::steady_clock::now();
+
     std::unique_lock<std::mutex> mlock(mutex_);
     // waits until a decoder object is available
     while (queue_.empty()) {
@@ -41,7 +88,107 @@ Decoder *DecoderQueue::pop_() {
     }
     auto item = queue_.front();
     queue_.pop();
+    mlock.unlock();
+
+    // new utterances get search parameters as per the current load
+    if (pruning_controller_) {
+        double wait_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wait_start_time).count();
+        pruning_controller_->report_wait(wait_ms);
+        item->set_search_config(pruning_controller_->current_config());
+    }
     return item;
 }
 
+void DecoderQueue::warmup_(const ModelSpec &model_spec) {
+    if (queue_.empty() || !(model_spec.warmup || model_spec.prefault_graph)) return;
+
+    auto start_time = std::chrono::steady_clock::now();
+    ChainModel *model = queue_.front()->model();
+
+    if (model_spec.prefault_graph) {
+        uint64 n_arcs = prefault_graph(*model->decode_fst);
+        for (auto const &graph : model->graphs) {
+            n_arcs += prefault_graph(*graph.second.decode_fst);
+        }
+        std::cout << "# Prefaulted " << n_arcs << " graph arcs (" << model_spec.name << ", "
+                  << model_spec.language_code << ")" << ENDL;
+    }
+
+    if (model_spec.warmup) {
+        const bool synthetic = model_spec.warmup_audio.empty();
+        const float samp_freq = model->feature_info->mfcc_opts.frame_opts.samp_freq;
+
+        std::string audio;
+        if (synthetic) {
+            synthetic_audio(samp_freq, audio);
+        } else {
+            std::ifstream audio_file(model_spec.warmup_audio, std::ios_base::in | std::ios_base::binary);
+            std::stringstream audio_buffer;
+            audio_buffer << audio_file.rdbuf();
+            audio = audio_buffer.str();
+        }
+
+        // every decoder is warmed up, as each has its own search, feature
+        // pipeline and nnet3 computer state (and the queue is not in use yet)
+        std::vector<Decoder *> decoders;
+        while (!queue_.empty()) {
+            decoders.push_back(queue_.front());
+            queue_.pop();
+        }
+
+        // each named graph is decoded once (the decoder state is not graph
+        // specific), spread over the decoders
+        std::vector<std::vector<std::string>> decoder_graphs(decoders.size(), std::vector<std::string>(1, ""));
+        std::size_t graph_idx = 0;
+        for (auto const &graph : model->graphs) {
+            decoder_graphs[graph_idx++ % decoders.size()].push_back(graph.first);
+        }
+
+        std::vector<std::future<void>> warmups;
+        for (std::size_t i = 0; i < decoders.size(); i++) {
+            Decoder *decoder = decoders[i];
+            const std::vector<std::string> &graphs = decoder_graphs[i];
+
+            queue_.push(decoder);
+            warmups.push_back(std::async(std::launch::async, [&audio, &graphs, synthetic, samp_freq, decoder]() {
+                for (auto const &graph : graphs) {
+                    std::istringstream audio_stream(audio);
+                    decoder->start_decoding("", graph);
+                    if (synthetic) {
+                        decoder->decode_raw_wav_audio(audio_stream, samp_freq, audio.size());
+                    } else {
+                        decoder->decode_wav_audio(audio_stream);
+                    }
+
+                    // n-best with word level output runs all the lattice post-processing
+                    utterance_results_t results;
+                    decoder->get_decoded_results(10, results, true);
+                    decoder->free_decoder();
+                }
+            }));
+        }
+
+        // a failed warm-up only leaves the decoders cold, the model still serves
+        for (auto &warmup : warmups) {
+            try {
+                warmup.get();
+            } catch (std::exception &e) {
+                KALDI_WARN << "Warm-up failed for model " << model_spec.name << " ("
+                           << model_spec.language_code << "): " << e.what();
+            }
+        }
+
+        // cold start timings are not reported to the pruning controller (on release)
+        for (Decoder *decoder : decoders) {
+            decoder->take_real_time_factor();
+        }
+    }
+
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time);
+    metrics().set(model_metric("warmup_ms", model_spec), ms.count());
+
+    std::cout << "# Warmed up " << queue_.size() << " decoders (" << model_spec.name << ", "
+              << model_spec.language_code << ") in " << ms.count() << "ms" << ENDL;
+}
+
 } // namespace kaldiserve
\ No newline at end of file
@@ -1,5 +1,8 @@
 // decoder-cpu.cpp - CPU Decoder Implementation
 
+// stl includes
+#include <algorithm>
+
 // local includes
 #include "config.hpp"
 #include "decoder.hpp"
@@ -8,33 +11,58 @@
 
 namespace kaldiserve {
 
-Decoder::Decoder(ChainModel *const model) : model_(model) {
+Decoder::Decoder(ChainModel *const model) : Decoder(model, SearchProfile(model->model_spec)) {}
+
+Decoder::Decoder(ChainModel *const model, const SearchProfile &profile) : model_(model), profile_(profile) {
 
-    if (model_->wb_info != nullptr) options.enable_word_level = true;
-    if (model_->rnnlm_info != nullptr) options.enable_rnnlm = true;
+    options.enable_word_level = model_->wb_info != nullptr;
+    options.enable_carpa = model_->carpa_lm != nullptr;
+    options.enable_rnnlm = model_->rnnlm_info != nullptr;
+
+    decode_fst_ = std::unique_ptr<fst::Fst<fst::StdArc>>(model_->decode_fst->Copy(true));
 
     // decoder vars initialization
     decoder_ = NULL;
     feature_pipeline_ = NULL;
     silence_weighting_ = NULL;
     adaptation_state_ = NULL;
+
+    base_config_ = decoder_config_ = profile_.decoder_config;
+    beam_override_ = lattice_beam_override_ = 0.0;
+    max_active_override_ = 0;
+    decode_secs_ = audio_secs_ = 0.0;
 }
 
 Decoder::~Decoder() noexcept {
     free_decoder();
 }
 
-void Decoder::start_decoding(const std::string &uuid) noexcept {
+void Decoder::start_decoding(const std::string &uuid, const std::string &graph) {
     free_decoder();
 
+    const fst::Fst<fst::StdArc> *decode_fst = decode_fst_.get();
+    if (!graph.empty()) {
+        std::unique_ptr<fst::Fst<fst::StdArc>> &graph_fst = graph_fsts_[graph];
+        if (!graph_fst) graph_fst.reset(model_->graph_fst(graph).Copy(true));
+        decode_fst = graph_fst.get();
+    }
+
+    // rescoring LMs share the word ids of the default graph only
+    options.graph = graph;
+    options.enable_carpa = graph.empty() && model_->carpa_lm != nullptr;
+    options.enable_rnnlm = graph.empty() && model_->rnnlm_info != nullptr;
+
+    // overrides of the previous request don't carry over to this one
+    _reset_search_config();
+
     adaptation_state_ = new kaldi::OnlineIvectorExtractorAdaptationState(model_->feature_info->ivector_extractor_info);
 
     feature_pipeline_ = new kaldi::OnlineNnet2FeaturePipeline(*model_->feature_info);
     feature_pipeline_->SetAdaptationState(*adaptation_state_);
 
-    decoder_ = new kaldi::SingleUtteranceNnet3Decoder(model_->lattice_faster_decoder_config,
+    decoder_ = new kaldi::SingleUtteranceNnet3Decoder(decoder_config_,
                                                       model_->trans_model, *model_->decodable_info,
-                                                      *model_->decode_fst, feature_pipeline_);
+                                                      *decode_fst, feature_pipeline_);
     decoder_->InitDecoding();
 
     silence_weighting_ = new kaldi::OnlineSilenceWeighting(model_->trans_model,
@@ -42,6 +70,7 @@ void Decoder::start_decoding(const std::string &uuid) noexcept {
                                                            model_->decodable_opts.frame_subsampling_factor);
 
     uuid_ = uuid;
+    decode_secs_ = audio_secs_ = 0.0;
 }
 
 void Decoder::free_decoder() noexcept {
@@ -62,6 +91,7 @@ void Decoder::free_decoder() noexcept {
         silence_weighting_ = NULL;
     }
     uuid_ = "";
+    is_cancelled_ = nullptr;
 }
 
 void Decoder::decode_stream_wav_chunk(std::istream &wav_stream) {
@@ -158,10 +188,65 @@ void Decoder::decode_raw_wav_audio(std::istream &wav_stream,
     }
 }
 
+bool Decoder::needs_lattice(const int &n_best, const bool &word_level) const noexcept {
+    return n_best > 1 || (options.enable_word_level && word_level) ||
+           options.enable_carpa || options.enable_rnnlm;
+}
+
+bool Decoder::get_decoded_lattice(kaldi::CompactLattice &clat,
+                                  const bool &bidi_streaming) {
+    if (!_finish_decoding(bidi_streaming)) return false;
+
+    try {
+        decoder_->GetLattice(true, &clat);
+    } catch (std::exception &e) {
+        KALDI_ERR << "unexpected error during decoding lattice :: " << e.what();
+    }
+    return true;
+}
+
 void Decoder::get_decoded_results(const int &n_best,
                                   utterance_results_t &results,
                                   const bool &word_level,
                                   const bool &bidi_streaming) {
+    // fast path for the top transcript only: take the best path straight
+    // from the decoder's traceback, skipping lattice determinization and
+    // n-best extraction
+    if (!needs_lattice(n_best, word_level)) {
+        if (!_finish_decoding(bidi_streaming)) return;
+
+        try {
+            kaldi::Lattice best_path;
+            decoder_->GetBestPath(true, &best_path);
+
+            if (best_path.NumStates() == 0) {
+                KALDI_WARN << "no best path found";
+                return;
+            }
+
+            Alternative alt;
+            path_to_alternative(best_path, model_->graph_words(options.graph), alt);
+            results.push_back(alt);
+        } catch (std::exception &e) {
+            KALDI_ERR << "unexpected error during decoding best path :: " << e.what();
+        }
+        return;
+    }
+
+    kaldi::CompactLattice clat;
+    if (!get_decoded_lattice(clat, bidi_streaming)) return;
+    _check_cancelled();
+
+    try {
+        find_alternatives(clat, n_best, results, word_level, model_, options);
+    } catch (std::exception &e) {
+        KALDI_ERR << "unexpected error during decoding lattice :: " << e.what(); 
+    }
+}
+
+bool Decoder::_finish_decoding(const bool &bidi_streaming) {
+    _check_cancelled();
+
     if (!bidi_streaming) {
         feature_pipeline_->InputFinished();
         decoder_->AdvanceDecoding();
@@ -170,21 +255,70 @@ void Decoder::get_decoded_results(const int &n_best,
 
     if (decoder_->NumFramesDecoded() == 0) {
         KALDI_WARN << "audio may be empty :: decoded no frames";
-        return;
+        return false;
     }
+    return true;
+}
 
-    kaldi::CompactLattice clat;
-    try {
-        decoder_->GetLattice(true, &clat);
-        find_alternatives(clat, n_best, results, word_level, model_, options);
-    } catch (std::exception &e) {
-        KALDI_ERR << "unexpected error during decoding lattice :: " << e.what(); 
+void Decoder::override_search_config(const float &beam,
+                                     const int &max_active,
+                                     const float &lattice_beam) noexcept {
+    beam_override_ = beam;
+    max_active_override_ = max_active;
+    lattice_beam_override_ = lattice_beam;
+}
+
+void Decoder::_reset_search_config() noexcept {
+    const float beam = beam_override_, lattice_beam = lattice_beam_override_;
+    const int max_active = max_active_override_;
+    beam_override_ = lattice_beam_override_ = 0.0;
+    max_active_override_ = 0;
+
+    decoder_config_ = base_config_;
+
+    const ModelSpec &spec = profile_.model_spec;
+    const kaldi::LatticeFasterDecoderConfig &model_config = profile_.decoder_config;
+
+    const float max_beam = spec.max_beam > 0 ? spec.max_beam : model_config.beam;
+    const int32 max_max_active = spec.max_max_active > 0 ? spec.max_max_active : model_config.max_active;
+    const float max_lattice_beam = spec.max_lattice_beam > 0 ? spec.max_lattice_beam : model_config.lattice_beam;
+
+    if (beam > 0) {
+        decoder_config_.beam = std::max(std::min(spec.min_beam, max_beam), std::min(beam, max_beam));
+    }
+    if (max_active > 0) {
+        decoder_config_.max_active = std::max(std::max(model_config.min_active, std::min(spec.min_max_active, max_max_active)),
+                                              std::min(int32(max_active), max_max_active));
+    }
+    if (lattice_beam > 0) {
+        decoder_config_.lattice_beam = std::max(std::min(spec.min_lattice_beam, max_lattice_beam),
+                                                std::min(lattice_beam, max_lattice_beam));
+    }
+}
+
+double Decoder::real_time_factor() const noexcept {
+    return audio_secs_ > 0 ? decode_secs_ / audio_secs_ : 0.0;
+}
+
+double Decoder::take_real_time_factor() noexcept {
+    double rtf = real_time_factor();
+    decode_secs_ = audio_secs_ = 0.0;
+    return rtf;
+}
+
+void Decoder::_check_cancelled() const {
+    if (is_cancelled_ && is_cancelled_()) {
+        throw DecodingCancelled();
     }
 }
 
 void Decoder::_decode_wave(kaldi::SubVector<kaldi::BaseFloat> &wave_part,
                            std::vector<std::pair<int32, kaldi::BaseFloat>> &delta_weights,
                            const kaldi::BaseFloat &samp_freq) {
+    _check_cancelled();
+
+    auto start_time = std::chrono::steady_clock::now();
+
     feature_pipeline_->AcceptWaveform(samp_freq, wave_part);
 
     if (silence_weighting_->Active() && feature_pipeline_->IvectorFeature() != NULL) {
@@ -195,6 +329,9 @@ void Decoder::_decode_wave(kaldi::SubVector<kaldi::BaseFloat> &wave_part,
     }
 
     decoder_->AdvanceDecoding();
+
+    decode_secs_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    audio_secs_ += wave_part.Dim() / samp_freq;
 }
 
 } // namespace kaldiserve
\ No newline at end of file
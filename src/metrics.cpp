@@ -0,0 +1,33 @@
+// metrics.cpp - Runtime Metrics Implementation
+
+// local includes
+#include "metrics.hpp"
+
+
+namespace kaldiserve {
+
+void Metrics::increment(const std::string &name, const double &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    values_[name] += value;
+}
+
+void Metrics::set(const std::string &name, const double &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    values_[name] = value;
+}
+
+std::map<std::string, double> Metrics::snapshot() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return values_;
+}
+
+Metrics &metrics() {
+    static Metrics global_metrics;
+    return global_metrics;
+}
+
+std::string model_metric(const std::string &name, const ModelSpec &model_spec) {
+    return name + "{model=\"" + model_spec.name + "\",language_code=\"" + model_spec.language_code + "\"}";
+}
+
+} // namespace kaldiserve
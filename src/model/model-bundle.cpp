@@ -0,0 +1,196 @@
+// model-bundle.cpp - Model Bundle Implementation
+
+// stl includes
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// lib includes
+#include <boost/filesystem.hpp>
+
+// kaldi includes
+#include "base/kaldi-common.h"
+
+// local includes
+#include "bundle.hpp"
+#include "utils.hpp"
+
+
+namespace kaldiserve {
+
+static const char BUNDLE_MAGIC[] = "KSBUNDLE";
+static const std::size_t BUNDLE_MAGIC_SIZE = sizeof(BUNDLE_MAGIC) - 1;
+static const uint64 BUNDLE_ALIGNMENT = 4096;
+
+template <typename T>
+static void read_value(std::istream &is, T &value) {
+    is.read(reinterpret_cast<char *>(&value), sizeof(T));
+}
+
+template <typename T>
+static void write_value(std::ostream &os, const T &value) {
+    os.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+bool ModelBundle::is_bundle(const std::string &path) {
+    if (!boost::filesystem::is_regular_file(path)) return false;
+
+    std::ifstream bundle_stream(path, std::ios_base::in | std::ios_base::binary);
+    char magic[BUNDLE_MAGIC_SIZE];
+    bundle_stream.read(magic, BUNDLE_MAGIC_SIZE);
+    return bundle_stream && std::memcmp(magic, BUNDLE_MAGIC, BUNDLE_MAGIC_SIZE) == 0;
+}
+
+std::string ModelBundle::root_dir(const std::string &path) {
+    if (!is_bundle(path)) return path;
+    return boost::filesystem::path(path).parent_path().string();
+}
+
+ModelBundle::ModelBundle(const std::string &path) : path_(path) {
+    std::ifstream bundle_stream(path, std::ios_base::in | std::ios_base::binary);
+    if (!bundle_stream) {
+        KALDI_ERR << "Could not open model bundle " << path;
+    }
+
+    char magic[BUNDLE_MAGIC_SIZE];
+    bundle_stream.read(magic, BUNDLE_MAGIC_SIZE);
+    if (!bundle_stream || std::memcmp(magic, BUNDLE_MAGIC, BUNDLE_MAGIC_SIZE) != 0) {
+        KALDI_ERR << path << " is not a model bundle";
+    }
+
+    uint32 version = 0, n_sections = 0;
+    read_value(bundle_stream, version);
+    if (version != BUNDLE_VERSION) {
+        KALDI_ERR << "Model bundle " << path << " has version " << version
+                  << ", expected " << BUNDLE_VERSION << ". Repack it with this version of `kaldiserve-pack`.";
+    }
+
+    read_value(bundle_stream, n_sections);
+    for (uint32 i = 0; i < n_sections && bundle_stream; i++) {
+        uint32 name_size = 0;
+        read_value(bundle_stream, name_size);
+
+        std::string name(name_size, '\0');
+        bundle_stream.read(&name[0], name_size);
+
+        uint64 offset = 0, size = 0;
+        read_value(bundle_stream, offset);
+        read_value(bundle_stream, size);
+        sections_[name] = std::make_pair(offset, size);
+    }
+
+    if (!bundle_stream) {
+        KALDI_ERR << "Truncated section table in model bundle " << path;
+    }
+}
+
+ModelBundle::~ModelBundle() {
+    if (!extract_dir_.empty()) {
+        boost::system::error_code error;
+        boost::filesystem::remove_all(extract_dir_, error);
+    }
+}
+
+bool ModelBundle::has(const std::string &name) const noexcept {
+    return sections_.find(name) != sections_.end();
+}
+
+uint64 ModelBundle::offset(const std::string &name) const {
+    auto it = sections_.find(name);
+    if (it == sections_.end()) {
+        KALDI_ERR << "Section " << name << " not found in model bundle " << path_;
+    }
+    return it->second.first;
+}
+
+std::string ModelBundle::rxfilename(const std::string &name) const {
+    return path_ + ":" + std::to_string(offset(name));
+}
+
+std::string ModelBundle::extract(const std::string &name) {
+    auto it = sections_.find(name);
+    if (it == sections_.end()) {
+        KALDI_ERR << "Section " << name << " not found in model bundle " << path_;
+    }
+
+    std::lock_guard<std::mutex> lock(extract_mutex_);
+
+    if (extract_dir_.empty()) {
+        boost::filesystem::path extract_dir =
+            boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("kaldiserve-%%%%-%%%%-%%%%");
+        boost::filesystem::create_directories(extract_dir);
+        extract_dir_ = extract_dir.string();
+    }
+
+    std::string filepath = join_path(extract_dir_, name);
+    if (exists(filepath)) return filepath;
+    boost::filesystem::create_directories(boost::filesystem::path(filepath).parent_path());
+
+    std::string contents(it->second.second, '\0');
+    std::ifstream bundle_stream(path_, std::ios_base::in | std::ios_base::binary);
+    bundle_stream.seekg(it->second.first);
+    bundle_stream.read(&contents[0], contents.size());
+
+    std::ofstream file_stream(filepath, std::ios_base::out | std::ios_base::binary);
+    if (!bundle_stream || !file_stream.write(contents.data(), contents.size())) {
+        KALDI_ERR << "Could not extract " << name << " from model bundle " << path_;
+    }
+    return filepath;
+}
+
+void ModelBundleWriter::add(const std::string &name, const std::string &filepath) {
+    sections_.push_back(std::make_pair(name, filepath));
+}
+
+void ModelBundleWriter::write(const std::string &path) const {
+    // the section table goes first, so offsets are laid out upfront
+    uint64 table_size = BUNDLE_MAGIC_SIZE + 2 * sizeof(uint32);
+    for (auto const &section : sections_) {
+        table_size += sizeof(uint32) + section.first.size() + 2 * sizeof(uint64);
+    }
+
+    std::vector<std::pair<uint64, uint64>> layout;
+    uint64 offset = table_size;
+    for (auto const &section : sections_) {
+        offset = (offset + BUNDLE_ALIGNMENT - 1) / BUNDLE_ALIGNMENT * BUNDLE_ALIGNMENT;
+        uint64 size = boost::filesystem::file_size(section.second);
+        layout.push_back(std::make_pair(offset, size));
+        offset += size;
+    }
+
+    std::ofstream bundle_stream(path, std::ios_base::out | std::ios_base::binary);
+    if (!bundle_stream) {
+        KALDI_ERR << "Could not open " << path << " for writing";
+    }
+
+    bundle_stream.write(BUNDLE_MAGIC, BUNDLE_MAGIC_SIZE);
+    write_value(bundle_stream, BUNDLE_VERSION);
+    write_value(bundle_stream, uint32(sections_.size()));
+    for (std::size_t i = 0; i < sections_.size(); i++) {
+        write_value(bundle_stream, uint32(sections_[i].first.size()));
+        bundle_stream.write(sections_[i].first.data(), sections_[i].first.size());
+        write_value(bundle_stream, layout[i].first);
+        write_value(bundle_stream, layout[i].second);
+    }
+
+    for (std::size_t i = 0; i < sections_.size(); i++) {
+        // zero padding up to the section start
+        uint64 position = bundle_stream.tellp();
+        std::string padding(layout[i].first - position, '\0');
+        bundle_stream.write(padding.data(), padding.size());
+
+        std::ifstream section_stream(sections_[i].second, std::ios_base::in | std::ios_base::binary);
+        // (streaming an empty buffer sets the failbit, so empty sections are skipped)
+        if (!section_stream || (layout[i].second > 0 && !(bundle_stream << section_stream.rdbuf()))) {
+            KALDI_ERR << "Could not write section " << sections_[i].first << " (" << sections_[i].second
+                      << ") to " << path;
+        }
+    }
+
+    if (!bundle_stream.flush()) {
+        KALDI_ERR << "Could not write model bundle " << path;
+    }
+}
+
+} // namespace kaldiserve
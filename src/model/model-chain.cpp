@@ -1,10 +1,25 @@
 // model-chain.cpp - Chain Model Implementation
 
 // stl includes
+#include <chrono>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <future>
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <vector>
+
+// kaldi includes
+#ifdef KALDISERVE_LOOKAHEAD_FSTS
+#include "fst/matcher-fst.h"
+#endif
 
 // local includes
+#include "bundle.hpp"
+#include "graph.hpp"
+#include "metrics.hpp"
 #include "model.hpp"
 #include "utils.hpp"
 #include "types.hpp"
@@ -12,103 +27,325 @@
 
 namespace kaldiserve {
 
+// Reads an FST in memory mapped mode. Only `const` FSTs (preferably written
+// with `fstconvert --fst_type=const --fst_align`) are actually mapped, other
+// FST types fall back to being read into heap memory. The FST can start at
+// an offset into the file (for graphs in model bundles).
+static fst::Fst<fst::StdArc> *read_mapped_fst(const std::string &fst_filepath, const uint64 &offset = 0) {
+    std::ifstream fst_stream(fst_filepath, std::ios_base::in | std::ios_base::binary);
+    if (!fst_stream || !fst_stream.seekg(offset)) {
+        KALDI_ERR << "Could not open decoding graph " << fst_filepath;
+    }
+
+    fst::FstReadOptions read_opts(fst_filepath);
+    read_opts.mode = fst::FstReadOptions::MAP;
+
+    fst::Fst<fst::StdArc> *decode_fst = fst::Fst<fst::StdArc>::Read(fst_stream, read_opts);
+    if (decode_fst == nullptr) {
+        KALDI_ERR << "Could not read decoding graph " << fst_filepath;
+    }
+
+    if (decode_fst->Type() != "const") {
+        KALDI_WARN << "Decoding graph " << fst_filepath << " is of type '" << decode_fst->Type()
+                   << "' and can not be memory mapped. Convert it to a const FST to share it across processes.";
+    }
+    return decode_fst;
+}
+
+// Loads the HCLr.fst and Gr.fst graphs produced by `utils/mkgraph_lookahead.sh`
+// and composes them lazily. States of the composed graph are only expanded
+// as the search visits them, so memory scales with the explored graph and
+// the LM can be swapped without recompiling HCLG.
+static void read_lookahead_fsts(const std::string &hclr_filepath,
+                                const std::string &gr_filepath,
+                                const std::string &disambig_tid_filepath,
+                                const int &cache_mb,
+                                ChainModel *const model) {
+#ifdef KALDISERVE_LOOKAHEAD_FSTS
+    fst::StdOLabelLookAheadFst *hclr_fst = fst::StdOLabelLookAheadFst::Read(hclr_filepath);
+    if (hclr_fst == nullptr) {
+        KALDI_ERR << "Could not read olabel lookahead graph " << hclr_filepath;
+    }
+    model->hclr_fst = std::unique_ptr<fst::Fst<fst::StdArc>>(hclr_fst);
+    model->gr_fst = std::unique_ptr<fst::Fst<fst::StdArc>>(fst::ReadFstKaldiGeneric(gr_filepath));
+
+    // HCLr keeps the disambiguation symbols, which the decoder must not see
+    std::vector<int32> disambig_tids;
+    if (!kaldi::ReadIntegerVectorSimple(disambig_tid_filepath, &disambig_tids)) {
+        KALDI_ERR << "Could not read disambiguation symbols " << disambig_tid_filepath;
+    }
+    model->decode_fst = std::unique_ptr<fst::Fst<fst::StdArc>>(
+        lookahead_compose(*model->hclr_fst, *model->gr_fst, disambig_tids, cache_mb));
+#else
+    KALDI_ERR << "kaldiserve was built without lookahead FST support (USE_LOOKAHEAD_FSTS), "
+              << "can not load " << hclr_filepath;
+#endif
+}
+
+// Loads a model component on its own thread, reporting the time it took.
+static std::future<void> load_async(const std::string &component,
+                                    const ModelSpec &model_spec,
+                                    const std::function<void()> &loader) {
+    return std::async(std::launch::async, [component, &model_spec, loader]() {
+        auto start_time = std::chrono::steady_clock::now();
+        loader();
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time);
+
+        metrics().set(model_metric("load_ms_" + component, model_spec), ms.count());
+
+        std::stringstream msg;
+        msg << "# Loaded " << component << " (" << model_spec.name << ", " << model_spec.language_code
+            << ") in " << ms.count() << "ms";
+        std::cout << msg.str() << ENDL;
+    });
+}
+
+// Waits for all the loads to finish, rethrowing the first failure (if any).
+static void wait_all(std::vector<std::future<void>> &loads) {
+    std::exception_ptr error = nullptr;
+    for (auto &load : loads) {
+        try {
+            load.get();
+        } catch (...) {
+            if (!error) error = std::current_exception();
+        }
+    }
+    if (error) std::rethrow_exception(error);
+}
+
 ChainModel::ChainModel(const ModelSpec &model_spec) : model_spec(model_spec) {
     std::string model_dir = model_spec.path;
 
     try {
-        std::string hclg_filepath = join_path(model_dir, "HCLG.fst");
-        std::string model_filepath = join_path(model_dir, "final.mdl");
-        std::string word_syms_filepath = join_path(model_dir, "words.txt");
-        std::string word_boundary_filepath = join_path(model_dir, "word_boundary.int");
+        // The model is either a directory or a bundle written by `kaldiserve-pack`,
+        // in which case the files are sections of the bundle and come preprocessed.
+        std::unique_ptr<ModelBundle> bundle;
+        if (ModelBundle::is_bundle(model_dir)) {
+            bundle = make_uniq<ModelBundle>(model_dir);
+
+            if (model_spec.lookahead_graph) {
+                KALDI_ERR << "Lookahead graphs can not be loaded from model bundle " << model_dir;
+            }
+            // graphs are resolved relative to the directory of the bundle
+            model_dir = ModelBundle::root_dir(model_dir);
+        }
+
+        auto model_file = [&](const std::string &name) {
+            return bundle ? bundle->rxfilename(name) : join_path(model_dir, name);
+        };
+        // text files are copied out of bundles, as they can't be read at an offset
+        auto model_text_file = [&](const std::string &name) {
+            return bundle ? bundle->extract(name) : join_path(model_dir, name);
+        };
+        auto has_model_file = [&](const std::string &name) {
+            return bundle ? bundle->has(name) : exists(join_path(model_dir, name));
+        };
 
-        std::string conf_dir = join_path(model_dir, "conf");
-        std::string mfcc_conf_filepath = join_path(conf_dir, "mfcc.conf");
-        std::string ivector_conf_filepath = join_path(conf_dir, "ivector_extractor.conf");
+        std::string hclg_filepath = model_file("HCLG.fst");
+        std::string hclr_filepath = join_path(model_dir, "HCLr.fst");
+        std::string gr_filepath = join_path(model_dir, "Gr.fst");
+        std::string disambig_tid_filepath = join_path(model_dir, "disambig_tid.int");
+        std::string state_counts_filepath = join_path(model_dir, "HCLG.state_counts");
+        std::string model_filepath = model_file("final.mdl");
+        std::string carpa_filepath = model_file("G.carpa");
+        std::string lm_filepath = model_file("G.fst");
 
-        std::string rnnlm_dir = join_path(model_dir, "rnnlm");
+        std::string mfcc_conf_filepath = model_text_file("conf/mfcc.conf");
+        std::string ivector_conf_filepath = model_text_file("conf/ivector_extractor.conf");
 
-        decode_fst = std::unique_ptr<fst::Fst<fst::StdArc>>(fst::ReadFstKaldiGeneric(hclg_filepath));
+        // independent components are loaded in parallel
+        std::vector<std::future<void>> loads;
 
-        {
+        loads.push_back(load_async("graph", model_spec, [&]() {
+            if (model_spec.lookahead_graph) {
+                read_lookahead_fsts(hclr_filepath, gr_filepath, disambig_tid_filepath,
+                                    model_spec.lookahead_cache_mb, this);
+            } else if (model_spec.mmap_graph && bundle) {
+                decode_fst = std::unique_ptr<fst::Fst<fst::StdArc>>(
+                    read_mapped_fst(bundle->path(), bundle->offset("HCLG.fst")));
+            } else if (model_spec.mmap_graph) {
+                decode_fst = std::unique_ptr<fst::Fst<fst::StdArc>>(read_mapped_fst(hclg_filepath));
+            } else {
+                decode_fst = std::unique_ptr<fst::Fst<fst::StdArc>>(fst::ReadFstKaldiGeneric(hclg_filepath));
+            }
+
+            if (model_spec.reorder_graph) {
+                if (model_spec.lookahead_graph) {
+                    KALDI_WARN << "Graph reordering is not supported for lookahead graphs, skipping.";
+                } else {
+                    if (model_spec.mmap_graph) {
+                        KALDI_WARN << "Reordering a memory mapped graph makes a private copy of it. "
+                                   << "Prefer reordering offline with `kaldiserve-reorder-graph`.";
+                    }
+                    state_counts_t state_counts;
+                    if (exists(state_counts_filepath)) {
+                        read_state_counts(state_counts_filepath, state_counts);
+                    }
+                    decode_fst = std::unique_ptr<fst::Fst<fst::StdArc>>(
+                        reorder_graph(*decode_fst, state_counts.empty() ? nullptr : &state_counts));
+                }
+            }
+        }));
+
+        loads.push_back(load_async("acoustic_model", model_spec, [&]() {
             bool binary;
             kaldi::Input ki(model_filepath, &binary);
 
             trans_model.Read(ki.Stream(), binary);
             am_nnet.Read(ki.Stream(), binary);
 
-            kaldi::nnet3::SetBatchnormTestMode(true, &(am_nnet.GetNnet()));
-            kaldi::nnet3::SetDropoutTestMode(true, &(am_nnet.GetNnet()));
-            kaldi::nnet3::CollapseModel(kaldi::nnet3::CollapseModelConfig(), &(am_nnet.GetNnet()));
-        }
+            // bundled models are already in test mode and collapsed
+            if (!bundle) {
+                kaldi::nnet3::SetBatchnormTestMode(true, &(am_nnet.GetNnet()));
+                kaldi::nnet3::SetDropoutTestMode(true, &(am_nnet.GetNnet()));
+                kaldi::nnet3::CollapseModel(kaldi::nnet3::CollapseModelConfig(), &(am_nnet.GetNnet()));
+            }
 
-        if (word_syms_filepath != "" && !(word_syms = std::unique_ptr<fst::SymbolTable>(fst::SymbolTable::ReadText(word_syms_filepath)))) {
-            KALDI_ERR << "Could not read symbol table from file " << word_syms_filepath;
-        }
+            decodable_opts.acoustic_scale = model_spec.acoustic_scale;
+            decodable_opts.frame_subsampling_factor = model_spec.frame_subsampling_factor;
+            decodable_info = make_uniq<kaldi::nnet3::DecodableNnetSimpleLoopedInfo>(decodable_opts, &am_nnet);
+        }));
 
-        if (exists(word_boundary_filepath)) {
-            kaldi::WordBoundaryInfoNewOpts word_boundary_opts;
-            wb_info = make_uniq<kaldi::WordBoundaryInfo>(word_boundary_opts, word_boundary_filepath);
-        } else {
-            KALDI_WARN << "Word boundary file" << word_boundary_filepath
-                       << " not found. Disabling word level features.";
+        loads.push_back(load_async("words", model_spec, [&]() {
+            if (bundle) {
+                bool binary;
+                kaldi::Input ki(model_file("words"), &binary);
+                word_table.read(ki.Stream(), binary);
+            } else {
+                word_table.read_text(join_path(model_dir, "words.txt"));
+            }
+
+            if (has_model_file("word_boundary.int")) {
+                std::string word_boundary_filepath = model_text_file("word_boundary.int");
+                kaldi::WordBoundaryInfoNewOpts word_boundary_opts;
+                wb_info = make_uniq<kaldi::WordBoundaryInfo>(word_boundary_opts, word_boundary_filepath);
+            } else {
+                KALDI_WARN << "Word boundary file " << join_path(model_spec.path, "word_boundary.int")
+                           << " not found. Disabling word level features.";
+            }
+        }));
+
+        loads.push_back(load_async("features", model_spec, [&]() {
+            feature_info = make_uniq<kaldi::OnlineNnet2FeaturePipelineInfo>();
+            feature_info->feature_type = "mfcc";
+            kaldi::ReadConfigFromFile(mfcc_conf_filepath, &(feature_info->mfcc_opts));
+
+            feature_info->use_ivectors = true;
+            kaldi::OnlineIvectorExtractionConfig ivector_extraction_opts;
+            kaldi::ReadConfigFromFile(ivector_conf_filepath, &ivector_extraction_opts);
+
+            // Expand paths if relative provided. We use model_dir as the base in
+            // such cases. In bundles, the paths are section names instead.
+            auto config_path = [&](const std::string &path) {
+                return bundle ? bundle->extract(path) : expand_relative_path(path, model_dir);
+            };
+            auto data_path = [&](const std::string &path) {
+                return bundle ? bundle->rxfilename(path) : expand_relative_path(path, model_dir);
+            };
+            ivector_extraction_opts.lda_mat_rxfilename = data_path(ivector_extraction_opts.lda_mat_rxfilename);
+            ivector_extraction_opts.global_cmvn_stats_rxfilename = data_path(ivector_extraction_opts.global_cmvn_stats_rxfilename);
+            ivector_extraction_opts.diag_ubm_rxfilename = data_path(ivector_extraction_opts.diag_ubm_rxfilename);
+            ivector_extraction_opts.ivector_extractor_rxfilename = data_path(ivector_extraction_opts.ivector_extractor_rxfilename);
+            ivector_extraction_opts.cmvn_config_rxfilename = config_path(ivector_extraction_opts.cmvn_config_rxfilename);
+            ivector_extraction_opts.splice_config_rxfilename = config_path(ivector_extraction_opts.splice_config_rxfilename);
+
+            feature_info->ivector_extractor_info.Init(ivector_extraction_opts);
+            feature_info->silence_weighting_config.silence_weight = model_spec.silence_weight;
+        }));
+
+        for (auto const &graph_spec : model_spec.graphs) {
+            std::string graph_dir = expand_relative_path(graph_spec.second, model_dir);
+            Graph *graph = &graphs[graph_spec.first];
+
+            loads.push_back(load_async("graph_" + graph_spec.first, model_spec, [&, graph, graph_dir]() {
+                std::string graph_filepath = join_path(graph_dir, "HCLG.fst");
+                if (model_spec.mmap_graph) {
+                    graph->decode_fst = std::unique_ptr<fst::Fst<fst::StdArc>>(read_mapped_fst(graph_filepath));
+                } else {
+                    graph->decode_fst = std::unique_ptr<fst::Fst<fst::StdArc>>(fst::ReadFstKaldiGeneric(graph_filepath));
+                }
+                graph->word_table.read_text(join_path(graph_dir, "words.txt"));
+            }));
         }
 
-        if (exists(rnnlm_dir) && 
-            exists(join_path(rnnlm_dir, "final.raw")) && 
-            exists(join_path(rnnlm_dir, "word_embedding.mat")) && 
-            exists(join_path(rnnlm_dir, "G.fst"))) {
-
-            rnnlm_opts.bos_index = std::stoi(model_spec.bos_index);
-            rnnlm_opts.eos_index = std::stoi(model_spec.eos_index);
-            
-            lm_to_subtract_fst =
-                std::unique_ptr<const fst::VectorFst<fst::StdArc>>(fst::ReadAndPrepareLmFst(join_path(rnnlm_dir, "G.fst")));
-            rnnlm_weight = model_spec.rnnlm_weight;
-
-            kaldi::ReadKaldiObject(join_path(rnnlm_dir, "final.raw"), &rnnlm);
-            KALDI_ASSERT(IsSimpleNnet(rnnlm));
-            kaldi::ReadKaldiObject(join_path(rnnlm_dir, "word_embedding.mat"), &word_embedding_mat);
-            
-            std::cout << "# Word Embeddings (RNNLM): " << word_embedding_mat.NumRows() << ENDL;
-
-            rnnlm_info =
-                make_uniq<const kaldi::rnnlm::RnnlmComputeStateInfo>(rnnlm_opts, rnnlm, word_embedding_mat);
-        } else {
-            KALDI_WARN << "RNNLM artefacts not found. Disabling RNNLM rescoring feature.";
+        if (has_model_file("G.carpa")) {
+            if (has_model_file("G.fst")) {
+                loads.push_back(load_async("carpa", model_spec, [&]() {
+                    carpa_lm_to_subtract_fst =
+                        std::unique_ptr<const fst::VectorFst<fst::StdArc>>(fst::ReadAndPrepareLmFst(lm_filepath));
+                    carpa_weight = model_spec.carpa_weight;
+                    carpa_compose_opts.lattice_compose_beam = model_spec.carpa_compose_beam;
+                    carpa_compose_opts.max_arcs = model_spec.carpa_max_arcs;
+
+                    carpa_lm = make_uniq<kaldi::ConstArpaLm>();
+                    kaldi::ReadKaldiObject(carpa_filepath, carpa_lm.get());
+                }));
+            } else {
+                KALDI_WARN << "First pass LM " << lm_filepath
+                           << " not found. Disabling ConstArpa rescoring feature.";
+            }
         }
 
-        feature_info = make_uniq<kaldi::OnlineNnet2FeaturePipelineInfo>();
-        feature_info->feature_type = "mfcc";
-        kaldi::ReadConfigFromFile(mfcc_conf_filepath, &(feature_info->mfcc_opts));
+        if (has_model_file("rnnlm/final.raw") &&
+            has_model_file("rnnlm/word_embedding.mat") &&
+            has_model_file("rnnlm/G.fst")) {
+
+            loads.push_back(load_async("rnnlm", model_spec, [&]() {
+                rnnlm_opts.bos_index = std::stoi(model_spec.bos_index);
+                rnnlm_opts.eos_index = std::stoi(model_spec.eos_index);
 
-        feature_info->use_ivectors = true;
-        kaldi::OnlineIvectorExtractionConfig ivector_extraction_opts;
-        kaldi::ReadConfigFromFile(ivector_conf_filepath, &ivector_extraction_opts);
+                lm_to_subtract_fst =
+                    std::unique_ptr<const fst::VectorFst<fst::StdArc>>(fst::ReadAndPrepareLmFst(model_file("rnnlm/G.fst")));
+                rnnlm_weight = model_spec.rnnlm_weight;
 
-        // Expand paths if relative provided. We use model_dir as the base in
-        // such cases.
-        ivector_extraction_opts.lda_mat_rxfilename = expand_relative_path(ivector_extraction_opts.lda_mat_rxfilename, model_dir);
-        ivector_extraction_opts.global_cmvn_stats_rxfilename = expand_relative_path(ivector_extraction_opts.global_cmvn_stats_rxfilename, model_dir);
-        ivector_extraction_opts.diag_ubm_rxfilename = expand_relative_path(ivector_extraction_opts.diag_ubm_rxfilename, model_dir);
-        ivector_extraction_opts.ivector_extractor_rxfilename = expand_relative_path(ivector_extraction_opts.ivector_extractor_rxfilename, model_dir);
-        ivector_extraction_opts.cmvn_config_rxfilename = expand_relative_path(ivector_extraction_opts.cmvn_config_rxfilename, model_dir);
-        ivector_extraction_opts.splice_config_rxfilename = expand_relative_path(ivector_extraction_opts.splice_config_rxfilename, model_dir);
+                kaldi::ReadKaldiObject(model_file("rnnlm/final.raw"), &rnnlm);
+                KALDI_ASSERT(IsSimpleNnet(rnnlm));
+                kaldi::ReadKaldiObject(model_file("rnnlm/word_embedding.mat"), &word_embedding_mat);
 
-        feature_info->ivector_extractor_info.Init(ivector_extraction_opts);
-        feature_info->silence_weighting_config.silence_weight = model_spec.silence_weight;
+                std::cout << "# Word Embeddings (RNNLM): " << word_embedding_mat.NumRows() << ENDL;
+
+                rnnlm_info =
+                    make_uniq<const kaldi::rnnlm::RnnlmComputeStateInfo>(rnnlm_opts, rnnlm, word_embedding_mat);
+                rnnlm_cache = make_uniq<RnnlmStateCache>(model_spec.rnnlm_cache_size);
+            }));
+        } else {
+            KALDI_WARN << "RNNLM artefacts not found. Disabling RNNLM rescoring feature.";
+        }
 
         lattice_faster_decoder_config.min_active = model_spec.min_active;
         lattice_faster_decoder_config.max_active = model_spec.max_active;
         lattice_faster_decoder_config.beam = model_spec.beam;
         lattice_faster_decoder_config.lattice_beam = model_spec.lattice_beam;
 
-        decodable_opts.acoustic_scale = model_spec.acoustic_scale;
-        decodable_opts.frame_subsampling_factor = model_spec.frame_subsampling_factor;
-        decodable_info = make_uniq<kaldi::nnet3::DecodableNnetSimpleLoopedInfo>(decodable_opts, &am_nnet);
+        wait_all(loads);
     
     } catch (const std::exception &e) {
         KALDI_ERR << e.what();
     }
 }
 
-} // namespace kaldiserve
\ No newline at end of file
+bool ChainModel::has_graph(const std::string &name) const noexcept {
+    return name.empty() || graphs.find(name) != graphs.end();
+}
+
+const fst::Fst<fst::StdArc> &ChainModel::graph_fst(const std::string &name) const {
+    if (name.empty()) return *decode_fst;
+
+    auto it = graphs.find(name);
+    if (it == graphs.end()) {
+        KALDI_ERR << "Decoding graph " << name << " not found for model " << model_spec.name;
+    }
+    return *it->second.decode_fst;
+}
+
+const WordTable &ChainModel::graph_words(const std::string &name) const {
+    if (name.empty()) return word_table;
+
+    auto it = graphs.find(name);
+    if (it == graphs.end()) {
+        KALDI_ERR << "Decoding graph " << name << " not found for model " << model_spec.name;
+    }
+    return it->second.word_table;
+}
+
+} // namespace kaldiserve
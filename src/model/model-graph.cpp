@@ -0,0 +1,149 @@
+// model-graph.cpp - Decoding Graph Utilities Implementation
+
+// stl includes
+#include <algorithm>
+#include <fstream>
+#include <queue>
+#include <string>
+
+// local includes
+#include "graph.hpp"
+
+
+namespace kaldiserve {
+
+AccessCountingFst::AccessCountingFst(const fst::Fst<Arc> &fst, state_counts_t *const state_counts)
+    : fst_(fst.Copy()), state_counts_(state_counts) {}
+
+void AccessCountingFst::InitArcIterator(StateId s, fst::ArcIteratorData<Arc> *data) const {
+    if (s >= state_counts_->size()) {
+        state_counts_->resize(s + 1, 0);
+    }
+    (*state_counts_)[s]++;
+    fst_->InitArcIterator(s, data);
+}
+
+void compute_graph_state_order(const fst::ExpandedFst<fst::StdArc> &graph,
+                               const state_counts_t *const state_counts,
+                               std::vector<fst::StdArc::StateId> &order) {
+    typedef fst::StdArc::StateId StateId;
+
+    const StateId num_states = graph.NumStates();
+    order.assign(num_states, fst::kNoStateId);
+    StateId next_id = 0;
+
+    // hot states first (most accessed ones packed together)
+    if (state_counts != nullptr) {
+        std::vector<StateId> hot_states;
+        for (StateId s = 0; s < num_states && s < state_counts->size(); s++) {
+            if ((*state_counts)[s] > 0) hot_states.push_back(s);
+        }
+        std::stable_sort(hot_states.begin(), hot_states.end(), [state_counts](const StateId &a, const StateId &b) {
+            return (*state_counts)[a] > (*state_counts)[b];
+        });
+        for (auto const &s : hot_states) {
+            order[s] = next_id++;
+        }
+    }
+
+    // breadth first order for the rest, so that successors of a state end up
+    // close to it
+    std::queue<StateId> state_queue;
+    std::vector<bool> visited(num_states, false);
+    if (graph.Start() != fst::kNoStateId) {
+        state_queue.push(graph.Start());
+        visited[graph.Start()] = true;
+    }
+    while (!state_queue.empty()) {
+        StateId s = state_queue.front();
+        state_queue.pop();
+        if (order[s] == fst::kNoStateId) order[s] = next_id++;
+
+        for (fst::ArcIterator<fst::Fst<fst::StdArc>> aiter(graph, s); !aiter.Done(); aiter.Next()) {
+            StateId nextstate = aiter.Value().nextstate;
+            if (!visited[nextstate]) {
+                visited[nextstate] = true;
+                state_queue.push(nextstate);
+            }
+        }
+    }
+
+    // unreachable states go at the end
+    for (StateId s = 0; s < num_states; s++) {
+        if (order[s] == fst::kNoStateId) order[s] = next_id++;
+    }
+}
+
+fst::ConstFst<fst::StdArc> *reorder_graph(const fst::Fst<fst::StdArc> &graph,
+                                          const state_counts_t *const state_counts) {
+    fst::VectorFst<fst::StdArc> vector_graph(graph);
+
+    std::vector<fst::StdArc::StateId> order;
+    compute_graph_state_order(vector_graph, state_counts, order);
+    fst::StateSort(&vector_graph, order);
+
+    // const fsts keep all the arcs in a single array laid out in state order
+    return new fst::ConstFst<fst::StdArc>(vector_graph);
+}
+
+fst::Fst<fst::StdArc> *lookahead_compose(const fst::Fst<fst::StdArc> &hclr_fst,
+                                         const fst::Fst<fst::StdArc> &gr_fst,
+                                         const std::vector<int32> &disambig_tids,
+                                         const int &cache_mb) {
+    typedef fst::RemoveSomeInputSymbolsMapper<fst::StdArc, int32> DisambigMapper;
+
+    // composition picks up the lookahead matcher of HCLr on its own
+    fst::CacheOptions compose_cache_opts(true, size_t(cache_mb) << 20);
+    fst::ComposeFst<fst::StdArc> composed_fst(hclr_fst, gr_fst, compose_cache_opts);
+
+    // the mapped arcs are cheap to recompute from the cached composition
+    fst::ArcMapFstOptions map_opts(fst::CacheOptions(true, 0));
+    return new fst::ArcMapFst<fst::StdArc, fst::StdArc, DisambigMapper>(
+        composed_fst, DisambigMapper(disambig_tids), map_opts);
+}
+
+uint64 prefault_graph(const fst::Fst<fst::StdArc> &graph) {
+    if (graph.Properties(fst::kExpanded, false) != fst::kExpanded) return 0;
+
+    uint64 n_arcs = 0;
+    for (fst::StateIterator<fst::Fst<fst::StdArc>> siter(graph); !siter.Done(); siter.Next()) {
+        const fst::StdArc::StateId s = siter.Value();
+        if (graph.Final(s) != fst::StdArc::Weight::Zero()) n_arcs++;
+
+        for (fst::ArcIterator<fst::Fst<fst::StdArc>> aiter(graph, s); !aiter.Done(); aiter.Next()) {
+            if (aiter.Value().nextstate != fst::kNoStateId) n_arcs++;
+        }
+    }
+    return n_arcs;
+}
+
+void read_state_counts(const std::string &filepath, state_counts_t &state_counts) {
+    std::ifstream counts_stream(filepath);
+    if (!counts_stream) {
+        KALDI_ERR << "Could not open state counts file " << filepath;
+    }
+
+    state_counts.clear();
+    fst::StdArc::StateId s;
+    uint64 count;
+    while (counts_stream >> s >> count) {
+        if (s < 0) {
+            KALDI_ERR << "Invalid state id " << s << " in state counts file " << filepath;
+        }
+        if (s >= state_counts.size()) state_counts.resize(s + 1, 0);
+        state_counts[s] += count;
+    }
+}
+
+void write_state_counts(const std::string &filepath, const state_counts_t &state_counts) {
+    std::ofstream counts_stream(filepath);
+    if (!counts_stream) {
+        KALDI_ERR << "Could not open state counts file " << filepath << " for writing";
+    }
+
+    for (std::size_t s = 0; s < state_counts.size(); s++) {
+        if (state_counts[s] > 0) counts_stream << s << " " << state_counts[s] << ENDL;
+    }
+}
+
+} // namespace kaldiserve
@@ -0,0 +1,81 @@
+// model-registry.cpp - Shared Model Registry Implementation
+
+// stl includes
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+// local includes
+#include "bundle.hpp"
+#include "model.hpp"
+#include "utils.hpp"
+
+
+namespace kaldiserve {
+
+std::shared_ptr<ChainModel> ModelRegistry::get(const ModelSpec &model_spec) {
+    const std::string key = load_key(model_spec);
+
+    std::shared_ptr<Slot> slot;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        // drop the slots of models that have been freed
+        for (auto it = slots_.begin(); it != slots_.end();) {
+            if (it->first != key && it->second->model.expired()) {
+                it = slots_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        std::shared_ptr<Slot> &slot_ref = slots_[key];
+        if (!slot_ref) slot_ref = std::make_shared<Slot>();
+        slot = slot_ref;
+    }
+
+    std::lock_guard<std::mutex> slot_lock(slot->mutex);
+
+    std::shared_ptr<ChainModel> model = slot->model.lock();
+    if (model) {
+        std::cout << ":: Sharing loaded model " << model->model_spec.name << " (" << model->model_spec.language_code
+                  << ") with " << model_spec.name << " (" << model_spec.language_code << ")" << ENDL;
+    } else {
+        model = std::make_shared<ChainModel>(model_spec);
+        slot->model = model;
+    }
+    return model;
+}
+
+std::string ModelRegistry::load_key(const ModelSpec &model_spec) {
+    // everything that `ChainModel` is built with (search parameters are
+    // per entry, see `SearchProfile`)
+    std::stringstream key;
+    key << canonical_path(model_spec.path)
+        << "|" << model_spec.mmap_graph
+        << "|" << model_spec.lookahead_graph
+        << "|" << model_spec.lookahead_cache_mb
+        << "|" << model_spec.reorder_graph
+        << "|" << model_spec.acoustic_scale
+        << "|" << model_spec.frame_subsampling_factor
+        << "|" << model_spec.silence_weight
+        << "|" << model_spec.word_confidence
+        << "|" << model_spec.carpa_weight
+        << "|" << model_spec.carpa_compose_beam
+        << "|" << model_spec.carpa_max_arcs
+        << "|" << model_spec.max_ngram_order
+        << "|" << model_spec.rnnlm_weight
+        << "|" << model_spec.rnnlm_cache_size
+        << "|" << model_spec.bos_index
+        << "|" << model_spec.eos_index;
+    // (graphs of a bundle are relative to its directory, like in `ChainModel`)
+    const std::string root_dir = ModelBundle::root_dir(model_spec.path);
+    for (auto const &graph : model_spec.graphs) {
+        key << "|" << graph.first << "=" << canonical_path(expand_relative_path(graph.second, root_dir));
+    }
+    return key.str();
+}
+
+} // namespace kaldiserve
@@ -0,0 +1,119 @@
+// model-rnnlm.cpp - Shared RNNLM State Cache Implementation
+
+// stl includes
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// local includes
+#include "model.hpp"
+
+
+namespace kaldiserve {
+
+RnnlmStateCache::RnnlmStateCache(const std::size_t &capacity) : capacity_(capacity) {
+    index_.reserve(capacity);
+}
+
+RnnlmStateCache::state_t RnnlmStateCache::get(const history_t &history) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = index_.find(history);
+    if (it == index_.end()) return nullptr;
+
+    // mark as most recently used
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->second;
+}
+
+void RnnlmStateCache::put(const history_t &history, const state_t &state) {
+    if (capacity_ == 0) return;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = index_.find(history);
+    if (it != index_.end()) {
+        // another request computed it meanwhile, keep the existing state
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return;
+    }
+
+    if (entries_.size() >= capacity_) {
+        index_.erase(entries_.back().first);
+        entries_.pop_back();
+    }
+    entries_.emplace_front(history, state);
+    index_[history] = entries_.begin();
+}
+
+
+template <typename Compute>
+RnnlmStateCache::state_t CachedRnnlmDeterministicFst::_lookup(const RnnlmStateCache::history_t &history,
+                                                              Compute compute) {
+    RnnlmStateCache::state_t state = cache_->get(history);
+    if (state != nullptr) {
+        cache_hits_++;
+        return state;
+    }
+
+    cache_misses_++;
+    state = RnnlmStateCache::state_t(compute());
+    cache_->put(history, state);
+    return state;
+}
+
+CachedRnnlmDeterministicFst::CachedRnnlmDeterministicFst(const int32 &max_ngram_order,
+                                                         const kaldi::rnnlm::RnnlmComputeStateInfo &info,
+                                                         RnnlmStateCache *cache)
+    : info_(info), cache_(cache), max_ngram_order_(max_ngram_order), start_state_(0),
+      bos_index_(info.opts.bos_index), eos_index_(info.opts.eos_index),
+      cache_hits_(0), cache_misses_(0) {
+
+    RnnlmStateCache::history_t bos_seq(1, bos_index_);
+    wseq_to_state_[bos_seq] = start_state_;
+    state_to_wseq_.push_back(bos_seq);
+    state_to_rnnlm_state_.push_back(_lookup(bos_seq, [this]() {
+        return new kaldi::rnnlm::RnnlmComputeState(info_, bos_index_);
+    }));
+}
+
+fst::StdArc::Weight CachedRnnlmDeterministicFst::Final(StateId s) {
+    KALDI_ASSERT(static_cast<size_t>(s) < state_to_wseq_.size());
+
+    kaldi::BaseFloat logprob = state_to_rnnlm_state_[s]->LogProbOfWord(eos_index_);
+    return Weight(-logprob);
+}
+
+bool CachedRnnlmDeterministicFst::GetArc(StateId s, Label ilabel, fst::StdArc *oarc) {
+    KALDI_ASSERT(static_cast<size_t>(s) < state_to_wseq_.size());
+
+    RnnlmStateCache::history_t wseq = state_to_wseq_[s];
+    // copy of the pointer, `state_to_rnnlm_state_` may grow below
+    RnnlmStateCache::state_t rnnlm = state_to_rnnlm_state_[s];
+    kaldi::BaseFloat logprob = rnnlm->LogProbOfWord(ilabel);
+
+    wseq.push_back(ilabel);
+    if (max_ngram_order_ > 0) {
+        while (wseq.size() >= max_ngram_order_) {
+            wseq.erase(wseq.begin(), wseq.begin() + 1);
+        }
+    }
+
+    auto result = wseq_to_state_.insert(std::make_pair(wseq, static_cast<StateId>(state_to_wseq_.size())));
+    if (result.second) {
+        state_to_wseq_.push_back(wseq);
+        state_to_rnnlm_state_.push_back(_lookup(wseq, [&rnnlm, &ilabel]() {
+            return rnnlm->GetSuccessorState(ilabel);
+        }));
+    }
+
+    oarc->ilabel = ilabel;
+    oarc->olabel = ilabel;
+    oarc->nextstate = result.first->second;
+    oarc->weight = Weight(-logprob);
+
+    return true;
+}
+
+} // namespace kaldiserve
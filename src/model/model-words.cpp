@@ -0,0 +1,106 @@
+// model-words.cpp - Compact Word Table Implementation
+
+// stl includes
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// local includes
+#include "model.hpp"
+
+
+namespace kaldiserve {
+
+void WordTable::read_text(const std::string &filepath) {
+    std::ifstream words_stream(filepath);
+    if (!words_stream) {
+        KALDI_ERR << "Could not read symbol table from file " << filepath;
+    }
+
+    // words indexed by id, used only while building the pool
+    std::vector<std::string> words;
+    std::size_t pool_size = 0;
+
+    std::string line, word;
+    int64 id;
+    while (std::getline(words_stream, line)) {
+        std::istringstream line_stream(line);
+        if (!(line_stream >> word)) continue; // empty line
+
+        if (!(line_stream >> id) || id < 0 || id > std::numeric_limits<int32>::max()) {
+            KALDI_ERR << "Bad line in symbol table file " << filepath << ": " << line;
+        }
+        if (id >= words.size()) words.resize(id + 1);
+
+        pool_size += word.size() - words[id].size();
+        words[id] = word;
+    }
+
+    pool_.clear();
+    pool_.reserve(pool_size);
+    offsets_.resize(words.size() + 1);
+
+    for (std::size_t i = 0; i < words.size(); i++) {
+        offsets_[i] = pool_.size();
+        pool_ += words[i];
+    }
+    offsets_[words.size()] = pool_.size();
+}
+
+void WordTable::read(std::istream &is, bool binary) {
+    if (!binary) {
+        KALDI_ERR << "WordTable can only be read in binary mode";
+    }
+    kaldi::ExpectToken(is, binary, "<WordTable>");
+    kaldi::ReadIntegerVector(is, binary, &offsets_);
+
+    uint64 pool_size = 0;
+    kaldi::ReadBasicType(is, binary, &pool_size);
+    pool_.resize(pool_size);
+    is.read(&pool_[0], pool_size);
+
+    if (!is || offsets_.empty() || offsets_.back() != pool_size) {
+        KALDI_ERR << "Corrupted word table";
+    }
+    kaldi::ExpectToken(is, binary, "</WordTable>");
+}
+
+void WordTable::write(std::ostream &os, bool binary) const {
+    if (!binary) {
+        KALDI_ERR << "WordTable can only be written in binary mode";
+    }
+    kaldi::WriteToken(os, binary, "<WordTable>");
+    kaldi::WriteIntegerVector(os, binary, offsets_);
+    kaldi::WriteBasicType(os, binary, uint64(pool_.size()));
+    os.write(pool_.data(), pool_.size());
+    kaldi::WriteToken(os, binary, "</WordTable>");
+}
+
+std::string WordTable::word(const int32 &id) const {
+    if (id < 0 || id >= size()) return "";
+    return pool_.substr(offsets_[id], offsets_[id + 1] - offsets_[id]);
+}
+
+void WordTable::join(const std::vector<int32> &word_ids, const char &separator, std::string &output) const {
+    std::size_t length = word_ids.empty() ? 0 : word_ids.size() - 1;
+    for (auto const &id : word_ids) {
+        if (id >= 0 && id < size()) length += offsets_[id + 1] - offsets_[id];
+    }
+
+    output.clear();
+    output.reserve(length);
+
+    for (std::size_t i = 0; i < word_ids.size(); i++) {
+        const int32 id = word_ids[i];
+        if (id >= 0 && id < size()) {
+            output.append(pool_, offsets_[id], offsets_[id + 1] - offsets_[id]);
+        }
+        if (i != word_ids.size() - 1) {
+            output += separator;
+        }
+    }
+}
+
+} // namespace kaldiserve
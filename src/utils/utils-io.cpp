@@ -34,6 +34,24 @@ bool exists(std::string path) {
   return boost::filesystem::exists(fs_path);
 }
 
+std::string canonical_path(std::string path) {
+  return boost::filesystem::canonical(boost::filesystem::path(path)).string();
+}
+
+std::size_t directory_size(std::string path) {
+  if (boost::filesystem::is_regular_file(path)) {
+    return boost::filesystem::file_size(path);
+  }
+
+  std::size_t size = 0;
+  for (boost::filesystem::recursive_directory_iterator it(path), end; it != end; ++it) {
+    if (boost::filesystem::is_regular_file(it->status())) {
+      size += boost::filesystem::file_size(it->path());
+    }
+  }
+  return size;
+}
+
 void parse_model_specs(const std::string &toml_path, std::vector<ModelSpec> &model_specs) {
     auto config = cpptoml::parse_file(toml_path);
     auto models = config->get_table_array("model");
@@ -44,6 +62,13 @@ void parse_model_specs(const std::string &toml_path, std::vector<ModelSpec> &mod
         auto maybe_name = model->get_as<std::string>("name");
         auto maybe_language_code = model->get_as<std::string>("language_code");
         auto maybe_n_decoders = model->get_as<int>("n_decoders");
+        auto maybe_lazy = model->get_as<bool>("lazy");
+        auto maybe_graphs = model->get_table("graphs");
+        auto maybe_warmup = model->get_as<bool>("warmup");
+        auto maybe_warmup_audio = model->get_as<std::string>("warmup_audio");
+        auto maybe_prefault_graph = model->get_as<bool>("prefault_graph");
+        auto maybe_stream_idle_timeout_ms = model->get_as<int>("stream_idle_timeout_ms");
+        auto maybe_max_stream_secs = model->get_as<int>("max_stream_secs");
 
         auto maybe_min_active = model->get_as<int>("min_active");
         auto maybe_max_active = model->get_as<int>("max_active");
@@ -52,8 +77,26 @@ void parse_model_specs(const std::string &toml_path, std::vector<ModelSpec> &mod
         auto maybe_lattice_beam = model->get_as<double>("lattice_beam");
         auto maybe_acoustic_scale = model->get_as<double>("acoustic_scale");
         auto maybe_silence_weight = model->get_as<double>("silence_weight");
+        auto maybe_mmap_graph = model->get_as<bool>("mmap_graph");
+        auto maybe_lookahead_graph = model->get_as<bool>("lookahead_graph");
+        auto maybe_lookahead_cache_mb = model->get_as<int>("lookahead_cache_mb");
+        auto maybe_reorder_graph = model->get_as<bool>("reorder_graph");
+        auto maybe_adaptive_pruning = model->get_as<bool>("adaptive_pruning");
+        auto maybe_pressure_wait_ms = model->get_as<double>("pressure_wait_ms");
+        auto maybe_pressure_rtf = model->get_as<double>("pressure_rtf");
+        auto maybe_min_max_active = model->get_as<int>("min_max_active");
+        auto maybe_min_beam = model->get_as<double>("min_beam");
+        auto maybe_min_lattice_beam = model->get_as<double>("min_lattice_beam");
+        auto maybe_max_max_active = model->get_as<int>("max_max_active");
+        auto maybe_max_beam = model->get_as<double>("max_beam");
+        auto maybe_max_lattice_beam = model->get_as<double>("max_lattice_beam");
+        auto maybe_word_confidence = model->get_as<bool>("word_confidence");
+        auto maybe_carpa_weight = model->get_as<double>("carpa_weight");
+        auto maybe_carpa_compose_beam = model->get_as<double>("carpa_compose_beam");
+        auto maybe_carpa_max_arcs = model->get_as<int>("carpa_max_arcs");
         auto maybe_max_ngram_order = model->get_as<int>("max_ngram_order");
         auto maybe_rnnlm_weight = model->get_as<double>("rnnlm_weight");
+        auto maybe_rnnlm_cache_size = model->get_as<int>("rnnlm_cache_size");
         auto maybe_bos_index = model->get_as<std::string>("bos_index");
         auto maybe_eos_index = model->get_as<std::string>("eos_index");
 
@@ -63,6 +106,20 @@ void parse_model_specs(const std::string &toml_path, std::vector<ModelSpec> &mod
         spec.language_code = *maybe_language_code;
 
         if (maybe_n_decoders) spec.n_decoders = *maybe_n_decoders;
+        if (maybe_lazy) spec.lazy = *maybe_lazy;
+
+        spec.graphs.clear();
+        if (maybe_graphs) {
+            for (const auto &graph : *maybe_graphs) {
+                auto maybe_graph_path = graph.second->as<std::string>();
+                if (maybe_graph_path) spec.graphs[graph.first] = maybe_graph_path->get();
+            }
+        }
+        if (maybe_warmup) spec.warmup = *maybe_warmup;
+        if (maybe_warmup_audio) spec.warmup_audio = *maybe_warmup_audio;
+        if (maybe_prefault_graph) spec.prefault_graph = *maybe_prefault_graph;
+        if (maybe_stream_idle_timeout_ms) spec.stream_idle_timeout_ms = *maybe_stream_idle_timeout_ms;
+        if (maybe_max_stream_secs) spec.max_stream_secs = *maybe_max_stream_secs;
         if (maybe_beam) spec.beam = *maybe_beam;
         if (maybe_min_active) spec.min_active = *maybe_min_active;
         if (maybe_max_active) spec.max_active = *maybe_max_active;
@@ -70,8 +127,26 @@ void parse_model_specs(const std::string &toml_path, std::vector<ModelSpec> &mod
         if (maybe_acoustic_scale) spec.acoustic_scale = *maybe_acoustic_scale;
         if (maybe_frame_subsampling_factor) spec.frame_subsampling_factor = *maybe_frame_subsampling_factor;
         if (maybe_silence_weight) spec.silence_weight = *maybe_silence_weight;
+        if (maybe_mmap_graph) spec.mmap_graph = *maybe_mmap_graph;
+        if (maybe_lookahead_graph) spec.lookahead_graph = *maybe_lookahead_graph;
+        if (maybe_lookahead_cache_mb) spec.lookahead_cache_mb = *maybe_lookahead_cache_mb;
+        if (maybe_reorder_graph) spec.reorder_graph = *maybe_reorder_graph;
+        if (maybe_adaptive_pruning) spec.adaptive_pruning = *maybe_adaptive_pruning;
+        if (maybe_pressure_wait_ms) spec.pressure_wait_ms = *maybe_pressure_wait_ms;
+        if (maybe_pressure_rtf) spec.pressure_rtf = *maybe_pressure_rtf;
+        if (maybe_min_max_active) spec.min_max_active = *maybe_min_max_active;
+        if (maybe_min_beam) spec.min_beam = *maybe_min_beam;
+        if (maybe_min_lattice_beam) spec.min_lattice_beam = *maybe_min_lattice_beam;
+        if (maybe_max_max_active) spec.max_max_active = *maybe_max_max_active;
+        if (maybe_max_beam) spec.max_beam = *maybe_max_beam;
+        if (maybe_max_lattice_beam) spec.max_lattice_beam = *maybe_max_lattice_beam;
+        if (maybe_word_confidence) spec.word_confidence = *maybe_word_confidence;
+        if (maybe_carpa_weight) spec.carpa_weight = *maybe_carpa_weight;
+        if (maybe_carpa_compose_beam) spec.carpa_compose_beam = *maybe_carpa_compose_beam;
+        if (maybe_carpa_max_arcs) spec.carpa_max_arcs = *maybe_carpa_max_arcs;
         if (maybe_max_ngram_order) spec.max_ngram_order = *maybe_max_ngram_order;
         if (maybe_rnnlm_weight) spec.rnnlm_weight = *maybe_rnnlm_weight;
+        if (maybe_rnnlm_cache_size) spec.rnnlm_cache_size = *maybe_rnnlm_cache_size;
         if (maybe_bos_index) spec.bos_index = *maybe_bos_index;
         if (maybe_eos_index) spec.eos_index = *maybe_eos_index;
 
@@ -0,0 +1,106 @@
+// test-lookahead-graph.cpp - Lookahead Graph Composition Tests
+
+// stl includes
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// kaldi includes
+#include "base/kaldi-common.h"
+#include "decoder/decodable-matrix.h"
+#include "decoder/lattice-faster-decoder.h"
+#include "fst/matcher-fst.h"
+#include "fstext/fstext-lib.h"
+#include "lat/kaldi-lattice.h"
+
+// kaldiserve includes
+#include "kaldiserve/graph.hpp"
+#include "kaldiserve/utils.hpp"
+
+using namespace kaldiserve;
+
+// transition ids of the two words and the disambiguation symbol after each word
+static const int32 kOneTid = 1, kTwoTid = 2, kDisambigTid = 3;
+// word ids
+static const int32 kOne = 1, kTwo = 2;
+
+
+// HCLr like graph: any sequence of the two words (one transition id each),
+// every word followed by a disambiguation symbol.
+static fst::StdVectorFst make_hclr() {
+    fst::StdVectorFst hclr;
+    hclr.AddState();
+    hclr.AddState();
+    hclr.SetStart(0);
+    hclr.SetFinal(0, fst::TropicalWeight::One());
+
+    hclr.AddArc(0, fst::StdArc(kOneTid, kOne, fst::TropicalWeight::One(), 1));
+    hclr.AddArc(0, fst::StdArc(kTwoTid, kTwo, fst::TropicalWeight::One(), 1));
+    hclr.AddArc(1, fst::StdArc(kDisambigTid, 0, fst::TropicalWeight::One(), 0));
+    return hclr;
+}
+
+// Gr like graph: the sentence "one two"
+static fst::StdVectorFst make_gr() {
+    fst::StdVectorFst gr;
+    for (int i = 0; i < 3; i++) gr.AddState();
+    gr.SetStart(0);
+    gr.SetFinal(2, fst::TropicalWeight::One());
+
+    gr.AddArc(0, fst::StdArc(kOne, kOne, fst::TropicalWeight(0.5), 1));
+    gr.AddArc(1, fst::StdArc(kTwo, kTwo, fst::TropicalWeight(0.5), 2));
+    return gr;
+}
+
+// The composed graph has no disambiguation symbols left, and decodes
+// the sentence of Gr from frames scoring its transition ids.
+static void test_lookahead_decode() {
+    fst::StdOLabelLookAheadFst hclr(make_hclr());
+
+    // Gr gets relabeled like HCLr (`mkgraph_lookahead.sh` does this offline)
+    fst::StdVectorFst gr = make_gr();
+    fst::LabelLookAheadRelabeler<fst::StdArc>::Relabel(&gr, hclr, true);
+    fst::ArcSort(&gr, fst::StdILabelCompare());
+
+    std::unique_ptr<fst::Fst<fst::StdArc>> decode_fst(lookahead_compose(hclr, gr, {kDisambigTid}, 1));
+
+    for (fst::StateIterator<fst::Fst<fst::StdArc>> siter(*decode_fst); !siter.Done(); siter.Next()) {
+        for (fst::ArcIterator<fst::Fst<fst::StdArc>> aiter(*decode_fst, siter.Value()); !aiter.Done(); aiter.Next()) {
+            KALDI_ASSERT(aiter.Value().ilabel != kDisambigTid);
+        }
+    }
+
+    // one frame per word (the decodable only knows the two real transition ids)
+    kaldi::Matrix<kaldi::BaseFloat> loglikes(2, 2);
+    loglikes(0, kOneTid - 1) = 0.0;
+    loglikes(0, kTwoTid - 1) = -10.0;
+    loglikes(1, kOneTid - 1) = -10.0;
+    loglikes(1, kTwoTid - 1) = 0.0;
+    kaldi::DecodableMatrixScaled decodable(loglikes, 1.0);
+
+    kaldi::LatticeFasterDecoderConfig decoder_config;
+    kaldi::LatticeFasterDecoder decoder(*decode_fst, decoder_config);
+    KALDI_ASSERT(decoder.Decode(&decodable));
+    KALDI_ASSERT(decoder.ReachedFinal());
+
+    kaldi::Lattice best_path;
+    decoder.GetBestPath(&best_path);
+
+    std::vector<int32> alignment, words;
+    kaldi::LatticeWeight weight;
+    fst::GetLinearSymbolSequence(best_path, &alignment, &words, &weight);
+    KALDI_ASSERT(alignment == std::vector<int32>({kOneTid, kTwoTid}));
+    KALDI_ASSERT(words == std::vector<int32>({kOne, kTwo}));
+}
+
+int main() {
+    try {
+        test_lookahead_decode();
+    } catch (const std::exception &e) {
+        std::cerr << e.what();
+        return 1;
+    }
+
+    std::cout << ":: Lookahead graph tests passed" << ENDL;
+    return 0;
+}
@@ -0,0 +1,95 @@
+// test-model-registry.cpp - Shared Model Registry Tests
+
+// stl includes
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// lib includes
+#include <boost/filesystem.hpp>
+
+// kaldi includes
+#include "base/kaldi-common.h"
+
+// kaldiserve includes
+#include "kaldiserve/bundle.hpp"
+#include "kaldiserve/model.hpp"
+#include "kaldiserve/types.hpp"
+#include "kaldiserve/utils.hpp"
+
+using namespace kaldiserve;
+
+
+// Graphs of a bundle are relative to the directory of the bundle (as in
+// `ChainModel`) and not to the bundle file itself.
+static void test_bundle_graph_paths(const std::string &test_dir) {
+    std::string section_filepath = join_path(test_dir, "final.mdl");
+    std::ofstream(section_filepath) << "model";
+
+    ModelBundleWriter bundle;
+    bundle.add("final.mdl", section_filepath);
+    bundle.write(join_path(test_dir, "model.bundle"));
+
+    boost::filesystem::create_directories(join_path(test_dir, "graphs/names"));
+
+    ModelSpec model_spec;
+    model_spec.path = join_path(test_dir, "model.bundle");
+    model_spec.graphs["names"] = "graphs/names";
+
+    KALDI_ASSERT(ModelBundle::root_dir(model_spec.path) == test_dir);
+
+    std::string key = ModelRegistry::load_key(model_spec);
+    KALDI_ASSERT(key.find("names=" + canonical_path(join_path(test_dir, "graphs/names"))) != std::string::npos);
+}
+
+// Graphs of a model directory are relative to the directory itself.
+static void test_directory_graph_paths(const std::string &test_dir) {
+    std::string model_dir = join_path(test_dir, "model");
+    boost::filesystem::create_directories(join_path(model_dir, "graphs/names"));
+
+    ModelSpec model_spec;
+    model_spec.path = model_dir;
+    model_spec.graphs["names"] = "graphs/names";
+
+    KALDI_ASSERT(ModelBundle::root_dir(model_spec.path) == model_dir);
+
+    std::string key = ModelRegistry::load_key(model_spec);
+    KALDI_ASSERT(key.find("names=" + canonical_path(join_path(model_dir, "graphs/names"))) != std::string::npos);
+}
+
+// Specs loading the same model get the same key, whatever path they use.
+static void test_same_model_same_key(const std::string &test_dir) {
+    std::string model_dir = join_path(test_dir, "model");
+    boost::filesystem::create_directories(model_dir);
+
+    ModelSpec model_spec, other_model_spec;
+    model_spec.path = model_dir;
+    other_model_spec.path = join_path(test_dir, "./model/");
+    other_model_spec.name = "other";
+    other_model_spec.n_decoders = model_spec.n_decoders + 1;
+
+    KALDI_ASSERT(ModelRegistry::load_key(model_spec) == ModelRegistry::load_key(other_model_spec));
+
+    other_model_spec.acoustic_scale = model_spec.acoustic_scale * 2;
+    KALDI_ASSERT(ModelRegistry::load_key(model_spec) != ModelRegistry::load_key(other_model_spec));
+}
+
+int main() {
+    boost::filesystem::path test_dir =
+        boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("kaldiserve-test-%%%%-%%%%");
+    boost::filesystem::create_directories(test_dir);
+
+    try {
+        test_bundle_graph_paths(test_dir.string());
+        test_directory_graph_paths(test_dir.string());
+        test_same_model_same_key(test_dir.string());
+    } catch (const std::exception &e) {
+        std::cerr << e.what();
+        boost::filesystem::remove_all(test_dir);
+        return 1;
+    }
+
+    boost::filesystem::remove_all(test_dir);
+    std::cout << ":: Model registry tests passed" << ENDL;
+    return 0;
+}
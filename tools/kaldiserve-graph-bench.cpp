@@ -0,0 +1,160 @@
+// kaldiserve-graph-bench.cpp - Decoding Graph Search Benchmark Tool
+
+// stl includes
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// kaldi includes
+#include "base/kaldi-common.h"
+#include "base/timer.h"
+#include "util/common-utils.h"
+#include "decoder/decodable-matrix.h"
+#include "decoder/lattice-faster-decoder.h"
+#include "feat/wave-reader.h"
+#include "nnet3/decodable-online-looped.h"
+#include "online2/online-nnet2-feature-pipeline.h"
+
+// kaldiserve includes
+#include "kaldiserve/graph.hpp"
+#include "kaldiserve/model.hpp"
+#include "kaldiserve/types.hpp"
+#include "kaldiserve/utils.hpp"
+
+using namespace kaldiserve;
+
+
+// Runs the acoustic model over a wav file and stores the (scaled) log
+// likelihoods per transition id, so that the search can be timed in isolation.
+static void compute_loglikes(ChainModel &model, const std::string &wav_filepath,
+                             kaldi::Matrix<kaldi::BaseFloat> &loglikes) {
+    std::ifstream wav_stream(wav_filepath, std::ios_base::in | std::ios_base::binary);
+    kaldi::WaveData wave_data;
+    wave_data.Read(wav_stream);
+
+    kaldi::OnlineNnet2FeaturePipeline feature_pipeline(*model.feature_info);
+    kaldi::SubVector<kaldi::BaseFloat> data(wave_data.Data(), 0);
+    feature_pipeline.AcceptWaveform(wave_data.SampFreq(), data);
+    feature_pipeline.InputFinished();
+
+    kaldi::nnet3::DecodableAmNnetLoopedOnline decodable(model.trans_model, *model.decodable_info,
+                                                        feature_pipeline.InputFeature(),
+                                                        feature_pipeline.IvectorFeature());
+
+    const int32 num_frames = decodable.NumFramesReady(),
+                num_indices = decodable.NumIndices();
+
+    // transition ids are 1-based (as expected by `DecodableMatrixScaled`)
+    loglikes.Resize(num_frames, num_indices);
+    for (int32 t = 0; t < num_frames; t++) {
+        for (int32 tid = 1; tid <= num_indices; tid++) {
+            loglikes(t, tid - 1) = decodable.LogLikelihood(t, tid);
+        }
+    }
+}
+
+// Decodes all the utterances on the given graph and returns the total search time
+static double time_search(const fst::Fst<fst::StdArc> &graph,
+                          const kaldi::LatticeFasterDecoderConfig &decoder_config,
+                          const std::vector<kaldi::Matrix<kaldi::BaseFloat>> &utt_loglikes) {
+    kaldi::LatticeFasterDecoder decoder(graph, decoder_config);
+    kaldi::Timer timer;
+
+    for (auto const &loglikes : utt_loglikes) {
+        kaldi::DecodableMatrixScaled decodable(loglikes, 1.0);
+        if (!decoder.Decode(&decodable)) {
+            KALDI_WARN << "Failed to reach a final state for an utterance";
+        }
+    }
+    return timer.Elapsed();
+}
+
+
+int main(int argc, char *argv[]) {
+    try {
+        const char *usage =
+            "Measures the search time per frame of a model's decoding graph before and after\n"
+            "cache-locality reordering. Acoustic likelihoods are computed upfront so that\n"
+            "only the graph search is timed. State access counts recorded during the run\n"
+            "can be written out for `kaldiserve-reorder-graph`.\n"
+            "\n"
+            "Usage: kaldiserve-graph-bench [options] <model-spec-toml> <wav-file-1> [<wav-file-2> ...]\n"
+            " e.g.: kaldiserve-graph-bench --write-state-counts=HCLG.state_counts model-spec.toml a.wav b.wav\n";
+
+        kaldi::ParseOptions po(usage);
+
+        std::string model_name, reordered_graph_filepath, state_counts_filepath;
+        po.Register("model", &model_name, "Name of the model to benchmark (defaults to the first one in the toml)");
+        po.Register("reordered-graph", &reordered_graph_filepath,
+                    "Reordered graph to compare against (defaults to reordering the model graph in memory)");
+        po.Register("write-state-counts", &state_counts_filepath, "File to write recorded state access counts to");
+
+        po.Read(argc, argv);
+
+        if (po.NumArgs() < 2) {
+            po.PrintUsage();
+            return 1;
+        }
+
+        std::vector<ModelSpec> model_specs;
+        parse_model_specs(po.GetArg(1), model_specs);
+
+        const ModelSpec *model_spec = nullptr;
+        for (auto const &spec : model_specs) {
+            if (model_name == "" || spec.name == model_name) {
+                model_spec = &spec;
+                break;
+            }
+        }
+        if (model_spec == nullptr) {
+            KALDI_ERR << "Model " << model_name << " not found in " << po.GetArg(1);
+        }
+        if (model_spec->lookahead_graph || model_spec->reorder_graph) {
+            KALDI_ERR << "Benchmark needs a static, non-reordered graph as the baseline";
+        }
+
+        ChainModel model(*model_spec);
+
+        std::vector<kaldi::Matrix<kaldi::BaseFloat>> utt_loglikes(po.NumArgs() - 1);
+        int64 num_frames = 0;
+        for (int32 i = 2; i <= po.NumArgs(); i++) {
+            compute_loglikes(model, po.GetArg(i), utt_loglikes[i - 2]);
+            num_frames += utt_loglikes[i - 2].NumRows();
+        }
+        if (num_frames == 0) {
+            KALDI_ERR << "No frames to decode";
+        }
+
+        // record state accesses on the original graph
+        state_counts_t state_counts;
+        {
+            AccessCountingFst counting_graph(*model.decode_fst, &state_counts);
+            time_search(counting_graph, model.lattice_faster_decoder_config, utt_loglikes);
+        }
+        if (state_counts_filepath != "") {
+            write_state_counts(state_counts_filepath, state_counts);
+        }
+
+        std::unique_ptr<fst::Fst<fst::StdArc>> reordered_graph;
+        if (reordered_graph_filepath != "") {
+            reordered_graph = std::unique_ptr<fst::Fst<fst::StdArc>>(fst::ReadFstKaldiGeneric(reordered_graph_filepath));
+        } else {
+            reordered_graph = std::unique_ptr<fst::Fst<fst::StdArc>>(reorder_graph(*model.decode_fst, &state_counts));
+        }
+
+        double original_secs = time_search(*model.decode_fst, model.lattice_faster_decoder_config, utt_loglikes);
+        double reordered_secs = time_search(*reordered_graph, model.lattice_faster_decoder_config, utt_loglikes);
+
+        std::cout << "# utterances: " << utt_loglikes.size() << ENDL
+                  << "# frames: " << num_frames << ENDL
+                  << "search time per frame (original): " << 1e6 * original_secs / num_frames << " us" << ENDL
+                  << "search time per frame (reordered): " << 1e6 * reordered_secs / num_frames << " us" << ENDL
+                  << "speedup: " << original_secs / reordered_secs << "x" << ENDL;
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << e.what();
+        return -1;
+    }
+}
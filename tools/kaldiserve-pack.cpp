@@ -0,0 +1,210 @@
+// kaldiserve-pack.cpp - Model Bundling Tool
+
+// stl includes
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+
+// lib includes
+#include <boost/filesystem.hpp>
+
+// kaldi includes
+#include "base/kaldi-common.h"
+#include "util/common-utils.h"
+#include "fstext/fstext-lib.h"
+#include "nnet3/am-nnet-simple.h"
+#include "nnet3/nnet-utils.h"
+#include "hmm/transition-model.h"
+
+// kaldiserve includes
+#include "kaldiserve/bundle.hpp"
+#include "kaldiserve/model.hpp"
+#include "kaldiserve/utils.hpp"
+
+using namespace kaldiserve;
+
+
+// Temporary directory for the preprocessed files, removed with everything in
+// it once out of scope (also when packing fails).
+class TempDir final {
+
+  public:
+    TempDir() : path_(boost::filesystem::temp_directory_path() /
+                      boost::filesystem::unique_path("kaldiserve-pack-%%%%-%%%%")) {
+        boost::filesystem::create_directories(path_);
+    }
+
+    TempDir(const TempDir &) = delete;
+    TempDir &operator=(const TempDir &) = delete;
+
+    ~TempDir() {
+        boost::system::error_code ec;
+        boost::filesystem::remove_all(path_, ec);
+    }
+
+    std::string file(const std::string &name) const {
+        return (path_ / name).string();
+    }
+
+  private:
+    boost::filesystem::path path_;
+};
+
+// Writes the acoustic model in test mode and collapsed, so that loading it
+// is only a read.
+static void pack_acoustic_model(const std::string &model_filepath, const std::string &out_filepath) {
+    kaldi::TransitionModel trans_model;
+    kaldi::nnet3::AmNnetSimple am_nnet;
+    {
+        bool binary;
+        kaldi::Input ki(model_filepath, &binary);
+        trans_model.Read(ki.Stream(), binary);
+        am_nnet.Read(ki.Stream(), binary);
+    }
+
+    kaldi::nnet3::SetBatchnormTestMode(true, &(am_nnet.GetNnet()));
+    kaldi::nnet3::SetDropoutTestMode(true, &(am_nnet.GetNnet()));
+    kaldi::nnet3::CollapseModel(kaldi::nnet3::CollapseModelConfig(), &(am_nnet.GetNnet()));
+
+    kaldi::Output ko(out_filepath, true);
+    trans_model.Write(ko.Stream(), true);
+    am_nnet.Write(ko.Stream(), true);
+}
+
+// Writes the decoding graph as an aligned const FST, so that it can be
+// memory mapped out of the bundle.
+static void pack_graph(const std::string &graph_filepath, const std::string &out_filepath) {
+    std::unique_ptr<fst::Fst<fst::StdArc>> graph(fst::ReadFstKaldiGeneric(graph_filepath));
+
+    std::unique_ptr<fst::ConstFst<fst::StdArc>> const_graph;
+    if (graph->Type() == "const") {
+        const_graph.reset(static_cast<fst::ConstFst<fst::StdArc> *>(graph.release()));
+    } else {
+        const_graph = make_uniq<fst::ConstFst<fst::StdArc>>(*graph);
+    }
+
+    std::ofstream graph_out_stream(out_filepath, std::ios_base::out | std::ios_base::binary);
+    fst::FstWriteOptions write_opts(out_filepath);
+    write_opts.align = true;
+
+    if (!graph_out_stream || !const_graph->Write(graph_out_stream, write_opts)) {
+        KALDI_ERR << "Could not write graph to " << out_filepath;
+    }
+}
+
+// Rewrites the file paths in the ivector extractor config to section names,
+// adding the files they point to to the bundle.
+static void pack_ivector_config(const std::string &model_dir, const std::string &config_filepath,
+                                const std::string &out_filepath, ModelBundleWriter &bundle) {
+    // option -> section name (named after the option, as the files of
+    // different options may well have the same file name)
+    const std::map<std::string, std::string> path_options = {
+        {"--lda-matrix", "ivector_extractor/lda-matrix"},
+        {"--global-cmvn-stats", "ivector_extractor/global-cmvn-stats"},
+        {"--diag-ubm", "ivector_extractor/diag-ubm"},
+        {"--ivector-extractor", "ivector_extractor/ivector-extractor"},
+        {"--cmvn-config", "conf/cmvn-config"},
+        {"--splice-config", "conf/splice-config"}};
+
+    std::ifstream config_stream(config_filepath);
+    std::ofstream config_out_stream(out_filepath);
+    if (!config_stream || !config_out_stream) {
+        KALDI_ERR << "Could not rewrite ivector extractor config " << config_filepath;
+    }
+
+    // section -> file (the last value of a repeated option wins, as when reading the config)
+    std::map<std::string, std::string> sections;
+
+    std::string line;
+    while (std::getline(config_stream, line)) {
+        std::size_t eq = line.find('=');
+        auto it = eq == std::string::npos ? path_options.end() : path_options.find(line.substr(0, eq));
+
+        if (it != path_options.end()) {
+            // relative paths are relative to the model dir (see ChainModel)
+            sections[it->second] = expand_relative_path(line.substr(eq + 1), model_dir);
+            line = it->first + "=" + it->second;
+        }
+        config_out_stream << line << "\n";
+    }
+
+    for (auto const &section : sections) {
+        bundle.add(section.first, section.second);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    try {
+        const char *usage =
+            "Packs a model directory into a single file bundle that can be used as a model `path`.\n"
+            "The acoustic model is stored collapsed, the graph as an aligned const FST (which can\n"
+            "be memory mapped right out of the bundle) and the symbol table pre-parsed, so that\n"
+            "loading does as little work as possible.\n"
+            "\n"
+            "Usage: kaldiserve-pack [options] <model-dir> <bundle-out>\n"
+            " e.g.: kaldiserve-pack ./models/english ./models/english.bundle\n";
+
+        kaldi::ParseOptions po(usage);
+        po.Read(argc, argv);
+
+        if (po.NumArgs() != 2) {
+            po.PrintUsage();
+            return 1;
+        }
+
+        std::string model_dir = po.GetArg(1),
+                    bundle_filepath = po.GetArg(2);
+
+        TempDir tmp_dir;
+        auto tmp_file = [&](const std::string &name) { return tmp_dir.file(name); };
+
+        ModelBundleWriter bundle;
+
+        pack_acoustic_model(join_path(model_dir, "final.mdl"), tmp_file("final.mdl"));
+        bundle.add("final.mdl", tmp_file("final.mdl"));
+
+        pack_graph(join_path(model_dir, "HCLG.fst"), tmp_file("HCLG.fst"));
+        bundle.add("HCLG.fst", tmp_file("HCLG.fst"));
+
+        WordTable word_table;
+        word_table.read_text(join_path(model_dir, "words.txt"));
+        {
+            kaldi::Output ko(tmp_file("words"), true);
+            word_table.write(ko.Stream(), true);
+        }
+        bundle.add("words", tmp_file("words"));
+
+        std::string conf_dir = join_path(model_dir, "conf");
+        bundle.add("conf/mfcc.conf", join_path(conf_dir, "mfcc.conf"));
+        pack_ivector_config(model_dir, join_path(conf_dir, "ivector_extractor.conf"),
+                            tmp_file("ivector_extractor.conf"), bundle);
+        bundle.add("conf/ivector_extractor.conf", tmp_file("ivector_extractor.conf"));
+
+        // optional files are copied as is
+        auto add_if_exists = [&](const std::string &name) {
+            std::string filepath = join_path(model_dir, name);
+            if (!exists(filepath)) return false;
+            bundle.add(name, filepath);
+            return true;
+        };
+
+        add_if_exists("word_boundary.int");
+        if (exists(join_path(model_dir, "G.carpa"))) {
+            add_if_exists("G.carpa");
+            add_if_exists("G.fst");
+        }
+        add_if_exists("rnnlm/final.raw");
+        add_if_exists("rnnlm/word_embedding.mat");
+        add_if_exists("rnnlm/G.fst");
+
+        bundle.write(bundle_filepath);
+
+        KALDI_LOG << "Packed " << model_dir << " into " << bundle_filepath
+                  << " (" << directory_size(bundle_filepath) << " bytes)";
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << e.what();
+        return -1;
+    }
+}
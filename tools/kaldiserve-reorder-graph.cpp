@@ -0,0 +1,71 @@
+// kaldiserve-reorder-graph.cpp - Decoding Graph Reordering Tool
+
+// stl includes
+#include <fstream>
+#include <memory>
+#include <string>
+
+// kaldi includes
+#include "base/kaldi-common.h"
+#include "util/common-utils.h"
+#include "fstext/fstext-lib.h"
+
+// kaldiserve includes
+#include "kaldiserve/graph.hpp"
+
+using namespace kaldiserve;
+
+
+int main(int argc, char *argv[]) {
+    try {
+        const char *usage =
+            "Renumbers the states of a decoding graph for cache locality during search and\n"
+            "writes it out as an aligned const FST (which can be loaded with `mmap_graph`).\n"
+            "Frequently accessed states (as per the recorded state counts) come first,\n"
+            "the rest follow in breadth first order.\n"
+            "\n"
+            "Usage: kaldiserve-reorder-graph [options] <graph-in> <graph-out>\n"
+            " e.g.: kaldiserve-reorder-graph --state-counts=HCLG.state_counts HCLG.fst HCLG.reordered.fst\n";
+
+        kaldi::ParseOptions po(usage);
+
+        std::string state_counts_filepath;
+        po.Register("state-counts", &state_counts_filepath,
+                    "State access counts file (as written by kaldiserve-graph-bench)");
+
+        po.Read(argc, argv);
+
+        if (po.NumArgs() != 2) {
+            po.PrintUsage();
+            return 1;
+        }
+
+        std::string graph_in_filepath = po.GetArg(1),
+                    graph_out_filepath = po.GetArg(2);
+
+        std::unique_ptr<fst::Fst<fst::StdArc>> graph(fst::ReadFstKaldiGeneric(graph_in_filepath));
+
+        state_counts_t state_counts;
+        if (state_counts_filepath != "") {
+            read_state_counts(state_counts_filepath, state_counts);
+        }
+
+        std::unique_ptr<fst::ConstFst<fst::StdArc>> reordered_graph(
+            reorder_graph(*graph, state_counts.empty() ? nullptr : &state_counts));
+
+        std::ofstream graph_out_stream(graph_out_filepath, std::ios_base::out | std::ios_base::binary);
+        fst::FstWriteOptions write_opts(graph_out_filepath);
+        write_opts.align = true;
+
+        if (!graph_out_stream || !reordered_graph->Write(graph_out_stream, write_opts)) {
+            KALDI_ERR << "Could not write reordered graph to " << graph_out_filepath;
+        }
+
+        KALDI_LOG << "Reordered " << reordered_graph->NumStates() << " states ("
+                  << state_counts.size() << " with access counts) into " << graph_out_filepath;
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << e.what();
+        return -1;
+    }
+}